@@ -13,6 +13,8 @@
 #include <Wt/Auth/AuthThrottle.h>
 #include <Wt/Auth/User.h>
 
+#include <functional>
+
 namespace Wt {
   namespace Auth {
 
@@ -176,6 +178,23 @@ public:
   virtual PasswordResult verifyPassword(const User& user,
                                         const WT_USTRING& password) const = 0;
 
+  /*! \brief Verifies a password for a given user, asynchronously.
+   *
+   * This is like verifyPassword(), but the result is passed to the
+   * \p callback, which is called from within the application's event
+   * loop. An implementation may compute the password hash in another
+   * thread, so that it does not occupy a server thread (and the
+   * session lock) while doing so.
+   *
+   * The default implementation calls verifyPassword() and passes its
+   * result to the \p callback immediately.
+   *
+   * \sa PasswordService::setHashingPool()
+   */
+  virtual void verifyPasswordAsync
+    (const User& user, const WT_USTRING& password,
+     const std::function<void (PasswordResult)>& callback) const;
+
   /*! \brief Sets a new password for the given user.
    *
    * This stores a new password for the user in the database.
@@ -0,0 +1,74 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_AUTH_AUTH_ATTEMPT_STORE_H_
+#define WT_AUTH_AUTH_ATTEMPT_STORE_H_
+
+#include <Wt/WDllDefs.h>
+
+#include <chrono>
+#include <string>
+
+namespace Wt {
+  namespace Auth {
+
+/*! \class AuthAttemptStore Wt/Auth/AuthAttemptStore.h Wt/Auth/AuthAttemptStore.h
+ *  \brief Abstract storage of failed authentication attempts.
+ *
+ * This is the storage used by RateLimitAuthThrottle. It counts the
+ * failed attempts for a key (e.g. a user or a client address) within
+ * a recent time window, outside of the user database.
+ *
+ * SharedMemoryAttemptStore is an implementation that shares the
+ * counts between the processes on a single host. To share the counts
+ * between hosts, you can implement this interface on top of an
+ * external store (such as a key-value store with expiring keys).
+ *
+ * An implementation must be thread-safe, and should be fast: it is
+ * consulted for every authentication attempt.
+ *
+ * \ingroup auth
+ */
+class WT_API AuthAttemptStore
+{
+public:
+  /*! \brief The failed attempts for a key.
+   */
+  struct Attempts {
+    /*! \brief The number of recent failed attempts.
+     */
+    int failures;
+
+    /*! \brief The time of the last failed attempt.
+     */
+    std::chrono::system_clock::time_point lastFailure;
+
+    Attempts() : failures(0) { }
+  };
+
+  /*! \brief Destructor.
+   */
+  virtual ~AuthAttemptStore();
+
+  /*! \brief Returns the failed attempts for a key.
+   *
+   * For an unknown key, this returns no failures.
+   */
+  virtual Attempts attempts(const std::string& key) const = 0;
+
+  /*! \brief Records a failed attempt for a key.
+   */
+  virtual void addFailure(const std::string& key) = 0;
+
+  /*! \brief Forgets the failed attempts for a key.
+   */
+  virtual void reset(const std::string& key) = 0;
+};
+
+  }
+}
+
+#endif // WT_AUTH_AUTH_ATTEMPT_STORE_H_
@@ -7,11 +7,13 @@
 #ifndef WT_AUTH_AUTH_MODEL_H_
 #define WT_AUTH_AUTH_MODEL_H_
 
+#include <Wt/Auth/AbstractPasswordService.h>
 #include <Wt/Auth/AuthService.h>
 #include <Wt/Auth/FormBaseModel.h>
 #include <Wt/Auth/Identity.h>
 #include <Wt/Auth/User.h>
 
+#include <functional>
 #include <memory>
 
 namespace Wt {
@@ -82,6 +84,23 @@ public:
   virtual bool validateField(Field field) override;
   virtual bool validate() override;
 
+  /*! \brief Validates the model, asynchronously.
+   *
+   * This is like validate(), but the password is verified using
+   * AbstractPasswordService::verifyPasswordAsync(), so that the
+   * (expensive) password hash may be computed outside of the server
+   * thread that handles the request. The result is passed to the \p
+   * callback, which may be called before this method returns.
+   *
+   * The model must not be deleted before the \p callback is called.
+   *
+   * If you reimplement validate() or validateField() to add
+   * validation, you may need to reimplement this method too.
+   *
+   * \sa AuthWidget::attemptPasswordLogin()
+   */
+  virtual void validateAsync(const std::function<void (bool)>& callback);
+
   /*! \brief Initializes client-side login throttling.
    *
    * If login attempt throttling is enabled, then this may also be
@@ -120,7 +139,8 @@ public:
 
   /*! \brief Logs the user out.
    *
-   * This also removes the remember-me cookie for the user.
+   * This also removes the remember-me cookie for the user, and the
+   * user's tokens from the AuthService::authTokenCache().
    */
   virtual void logout(Login& login);
 
@@ -203,6 +223,8 @@ public:
 
 private:
   int throttlingDelay_;
+
+  bool setPasswordResult(const User& user, PasswordResult result);
 };
 
   }
@@ -10,11 +10,13 @@
 #include <Wt/WQrCode.h>
 #include <Wt/WString.h>
 
+#include <Wt/Auth/AuthTokenCache.h>
 #include <Wt/Auth/User.h>
 #include <Wt/Auth/WAuthGlobal.h>
 
 namespace Wt {
   namespace Mail {
+    class AsyncClient;
     class Message;
   }
 
@@ -418,6 +420,31 @@ public:
    */
   bool authTokenUpdateEnabled() const { return authTokenUpdateEnabled_; }
 
+  /*! \brief Sets a cache for validated authentication tokens.
+   *
+   * When set, processAuthToken() remembers which user a token was
+   * validated for, for AuthTokenCache::timeToLive() seconds. Within
+   * that time, the token is accepted without querying the user
+   * database, and it is not replaced again: if it was already
+   * replaced, the same replacement token is returned. This avoids a
+   * burst of database queries and writes when many sessions are
+   * created at once, at the expense of accepting a token that was
+   * removed in the database (e.g. by another process) for at most
+   * that time.
+   *
+   * The default cache is \c nullptr: every token is looked up in the
+   * database.
+   *
+   * \sa processAuthToken()
+   */
+  void setAuthTokenCache(std::unique_ptr<AuthTokenCache> cache);
+
+  /*! \brief Returns the cache for validated authentication tokens.
+   *
+   * \sa setAuthTokenCache()
+   */
+  AuthTokenCache *authTokenCache() const { return authTokenCache_.get(); }
+
   /*! \brief Returns the authentication token cookie name.
    *
    * This is the default cookie name used for storing the authentication
@@ -700,8 +727,9 @@ public:
    *   "noreply-auth@www.webtoolkit.eu"
    *
    * \if cpp
-   * Then it uses Mail::Client to send the message, using default the
-   * default client settings.
+   * Then it uses the mailClient() to send the message, if one is
+   * set. Otherwise, it uses Mail::Client to send the message, using
+   * the default client settings.
    * \elseif java
    * Then it uses the JavaMail API to send the message, the SMTP settings
    * are configured using the smtp.host and smpt.port JWt configuration
@@ -709,6 +737,26 @@ public:
    * \endif
    */
   virtual void sendMail(const Mail::Message& message) const;
+
+#ifndef WT_TARGET_JAVA
+  /*! \brief Sets an asynchronous client to send emails.
+   *
+   * When set, sendMail() queues messages in this client, instead of
+   * connecting to the SMTP server with a Mail::Client while handling
+   * the request. This keeps (bulk) verification and lost password
+   * emails from blocking the server threads, and reuses connections
+   * to the SMTP server.
+   *
+   * The default client is \c nullptr.
+   */
+  void setMailClient(std::unique_ptr<Mail::AsyncClient> client);
+
+  /*! \brief Returns the client to send emails.
+   *
+   * \sa setMailClient()
+   */
+  Mail::AsyncClient *mailClient() const { return mailClient_.get(); }
+#endif // WT_TARGET_JAVA
   //!@}
 
   /** @name Multi-factor authentication (Time-Based One-Time Password).
@@ -1007,6 +1055,9 @@ private:
   bool emailVerificationReq_;
   int emailTokenValidity_; // minutes
   std::string redirectInternalPath_;
+#ifndef WT_TARGET_JAVA
+  std::unique_ptr<Mail::AsyncClient> mailClient_;
+#endif // WT_TARGET_JAVA
 
   bool authTokens_;
   bool authTokenUpdateEnabled_;
@@ -1014,6 +1065,7 @@ private:
   std::string authTokenCookieName_;
   std::string authTokenCookieDomain_;
   AuthCookiePrefix authTokenCookiePrefix_;
+  std::unique_ptr<AuthTokenCache> authTokenCache_;
 
   std::string mfaProvider_;
   bool mfaRequired_;
@@ -21,7 +21,9 @@ namespace Wt {
  *
  * This class is used in PasswordService and in AbstractMfaProcess. By
  * specializing this class, you can change Wt's behaviour related to
- * authentication throttling.
+ * authentication throttling. RateLimitAuthThrottle is such a
+ * specialization, which keeps the attempts in an AuthAttemptStore
+ * instead of in the user database.
  *
  * Throttling has to be enabled; it is enabled by calling
  * PasswordService::setAttemptThrottlingEnabled() for password
@@ -64,6 +66,19 @@ public:
    */
   virtual int delayForNextAttempt(const User& user) const;
 
+  /*! \brief Records the result of an authentication attempt.
+   *
+   * This is called after each (password or MFA) authentication
+   * attempt of the \p user, with \p success indicating whether it
+   * succeeded.
+   *
+   * The default implementation calls User::setAuthenticated(), which
+   * updates the attempt counts in the user database.
+   *
+   * \sa RateLimitAuthThrottle
+   */
+  virtual void recordAttempt(const User& user, bool success) const;
+
   /*! \brief Returns the number of seconds a user needs to wait
    *         between two authentication attempts, given the
    *         amount of failed attempts since the last successful
@@ -0,0 +1,153 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_AUTH_AUTH_TOKEN_CACHE_H_
+#define WT_AUTH_AUTH_TOKEN_CACHE_H_
+
+#include <Wt/WDllDefs.h>
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+#ifdef WT_THREADED
+#include <mutex>
+#endif // WT_THREADED
+
+namespace Wt {
+  namespace Auth {
+
+/*! \class AuthTokenCache Wt/Auth/AuthTokenCache.h Wt/Auth/AuthTokenCache.h
+ *  \brief An in-process cache of validated authentication tokens.
+ *
+ * Every new session of a user with a remember-me cookie looks up the
+ * authentication token in the user database, and (with
+ * AuthService::authTokenUpdateEnabled()) replaces it with a new
+ * token. When many sessions are created at once, for example when
+ * clients reconnect after a restart, or when a browser restores
+ * several tabs, this causes a burst of queries and writes.
+ *
+ * When an AuthService is configured with a cache (see
+ * AuthService::setAuthTokenCache()), AuthService::processAuthToken()
+ * remembers, for a short time, which user a token hash was
+ * validated for:
+ *  - a token that is presented again within that time identifies
+ *    the user without querying the database, and is not replaced
+ *    again;
+ *  - a token that was just replaced remains valid within that time,
+ *    and yields the same replacement token. Concurrent sessions of
+ *    the same browser then converge on a single new token instead of
+ *    logging the user out.
+ *
+ * Entries for a user are removed by AuthModel::logout() and
+ * PasswordService::updatePassword(). The cache is local to the
+ * process: in a deployment with multiple processes, a token that is
+ * removed by another process stays valid in this process for at most
+ * timeToLive() seconds.
+ *
+ * The cache is thread-safe.
+ *
+ * \ingroup auth
+ */
+class WT_API AuthTokenCache
+{
+public:
+  /*! \brief A cached token.
+   */
+  struct Entry {
+    /*! \brief The id of the user.
+     */
+    std::string userId;
+
+    /*! \brief The token that replaced this token, if any.
+     */
+    std::string newToken;
+
+    /*! \brief The validity of newToken (in seconds).
+     */
+    int newTokenValidity;
+
+    Entry() : newTokenValidity(-1) { }
+  };
+
+  /*! \brief Constructor.
+   *
+   * Creates a cache that remembers tokens for \p timeToLive seconds,
+   * and that holds at most \p maximumSize tokens.
+   */
+  explicit AuthTokenCache(int timeToLive = 10, int maximumSize = 10000);
+
+  AuthTokenCache(const AuthTokenCache&) = delete;
+  AuthTokenCache& operator=(const AuthTokenCache&) = delete;
+
+  /*! \brief Returns the time (in seconds) that tokens are remembered.
+   */
+  int timeToLive() const { return timeToLive_; }
+
+  /*! \brief Returns the maximum number of tokens.
+   */
+  int maximumSize() const { return maximumSize_; }
+
+  /*! \brief Looks up a token hash.
+   *
+   * Returns whether the hash was found (and did not expire). The
+   * validity of the new token in \p entry is reduced by the time
+   * that it was cached.
+   */
+  bool find(const std::string& hash, Entry& entry);
+
+  /*! \brief Adds a token hash.
+   */
+  void insert(const std::string& hash, const Entry& entry);
+
+  /*! \brief Removes a token hash.
+   */
+  void remove(const std::string& hash);
+
+  /*! \brief Removes all token hashes of a user.
+   */
+  void removeUser(const std::string& userId);
+
+  /*! \brief Removes all token hashes.
+   */
+  void clear();
+
+  /*! \brief Returns the number of cached token hashes.
+   */
+  int size() const;
+
+  /*! \brief Returns the number of successful lookups so far.
+   */
+  long long hits() const;
+
+  /*! \brief Returns the number of unsuccessful lookups so far.
+   */
+  long long misses() const;
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  struct Item {
+    Entry entry;
+    Clock::time_point added;
+  };
+
+  int timeToLive_, maximumSize_;
+  std::unordered_map<std::string, Item> items_;
+  long long hits_, misses_;
+
+#ifdef WT_THREADED
+  mutable std::mutex mutex_;
+#endif // WT_THREADED
+
+  bool expired(const Item& item, Clock::time_point now) const;
+  void removeExpired(Clock::time_point now);
+};
+
+  }
+}
+
+#endif // WT_AUTH_AUTH_TOKEN_CACHE_H_
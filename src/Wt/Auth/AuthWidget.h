@@ -326,6 +326,12 @@ public:
    */
   virtual void createMfaView();
 
+  /*! \brief Attempts to log in with the entered name and password.
+   *
+   * The model is validated using AuthModel::validateAsync(): the
+   * rendering of the response is deferred until the password has been
+   * verified.
+   */
   void attemptPasswordLogin();
 
   /*! \brief Displays the error message.
@@ -471,6 +477,7 @@ private:
   void samlDone(Saml::Process *process, const Identity& identity);
 #endif // WT_HAS_SAML
   void updatePasswordLoginView();
+  void handlePasswordValidated(bool valid);
 };
 
   }
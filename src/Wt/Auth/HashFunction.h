@@ -166,6 +166,62 @@ private:
   int count_;
 };
 
+#ifndef WT_TARGET_JAVA
+/*! \class Argon2HashFunction Wt/Auth/HashFunction.h
+ *  \brief A cryptographic hash function that implements Argon2id.
+ *
+ * This hashing function is intended for password hashes. Argon2id
+ * (RFC 9106) is memory-hard: in addition to the number of
+ * iterations, it is configured with the amount of memory needed to
+ * compute a hash, which makes attacks with dedicated hardware more
+ * expensive.
+ *
+ * The hash is stored in the standard encoded format (e.g.
+ * <tt>$argon2id$v=19$m=19456,t=2,p=1$...</tt>), which includes the
+ * parameters: changing them only affects new hashes.
+ *
+ * Every computation allocates the configured amount of memory, so it
+ * is advisable to bound the number of concurrent computations, for
+ * example with PasswordService::setHashingPool().
+ *
+ * \ingroup auth
+ */
+class WT_API Argon2HashFunction final : public HashFunction
+{
+public:
+  /*! \brief Constructor.
+   *
+   * The \p memoryCost is in KiB, \p iterations is the number of
+   * passes over the memory, and \p parallelism the number of lanes.
+   *
+   * The defaults (19 MiB, 2 iterations, 1 lane) are the minimum
+   * configuration recommended by OWASP.
+   */
+  Argon2HashFunction(int memoryCost = 19456, int iterations = 2,
+                     int parallelism = 1);
+
+  /*! \brief Returns the name for this hash function.
+   *
+   * Returns <tt>"argon2id"</tt>.
+   */
+  virtual std::string name() const override;
+
+  /*! \brief Computes the hash of a message + salt.
+   *
+   * The \p salt must be at least 8 characters long.
+   */
+  virtual std::string compute(const std::string& msg,
+                              const std::string& salt) const override;
+
+  virtual bool verify(const std::string& msg,
+                      const std::string& salt,
+                      const std::string& hash) const override;
+
+private:
+  int memoryCost_, iterations_, parallelism_;
+};
+#endif
+
   }
 }
 
@@ -0,0 +1,127 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_AUTH_PASSWORD_HASHING_POOL_H_
+#define WT_AUTH_PASSWORD_HASHING_POOL_H_
+
+#include <Wt/WDllDefs.h>
+
+#include <deque>
+#include <functional>
+
+#ifdef WT_THREADED
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif // WT_THREADED
+
+namespace Wt {
+  namespace Auth {
+
+/*! \class PasswordHashingPool Wt/Auth/PasswordHashingPool.h Wt/Auth/PasswordHashingPool.h
+ *  \brief A bounded pool of threads that compute password hashes.
+ *
+ * Password hash functions (such as BCryptHashFunction and
+ * Argon2HashFunction) are deliberately slow. When they are computed
+ * by the server threads, a burst of logins occupies all of them, and
+ * stalls the requests of every other session.
+ *
+ * A PasswordService that is configured with a hashing pool (see
+ * PasswordService::setHashingPool()) computes hashes for
+ * PasswordService::verifyPasswordAsync() in the threads of this
+ * pool. The number of threads bounds the CPU (and memory) spent on
+ * password hashing, and the queue bounds the number of waiting
+ * verifications: when it is full, new work is rejected, which is
+ * reported as a throttled login attempt.
+ *
+ * The pool is thread-safe, and keeps a few counters to monitor its
+ * load.
+ *
+ * \if cpp
+ * In a build without thread support, work is executed immediately
+ * by post().
+ * \endif
+ *
+ * \ingroup auth
+ */
+class WT_API PasswordHashingPool
+{
+public:
+  /*! \brief Constructor.
+   *
+   * Creates a pool with \p threads threads, and a queue for at most
+   * \p maximumQueueSize waiting jobs.
+   */
+  explicit PasswordHashingPool(int threads = 2, int maximumQueueSize = 256);
+
+  PasswordHashingPool(const PasswordHashingPool&) = delete;
+  PasswordHashingPool& operator=(const PasswordHashingPool&) = delete;
+
+  /*! \brief Destructor.
+   *
+   * Waits for the running jobs to finish. Jobs that are still waiting
+   * in the queue are discarded.
+   */
+  ~PasswordHashingPool();
+
+  /*! \brief Posts a job.
+   *
+   * Returns \c false, without executing the job, if the queue is full.
+   */
+  bool post(const std::function<void ()>& job);
+
+  /*! \brief Returns the number of threads.
+   */
+  int threadCount() const { return threadCount_; }
+
+  /*! \brief Returns the maximum number of waiting jobs.
+   */
+  int maximumQueueSize() const { return maximumQueueSize_; }
+
+  /*! \brief Returns the number of waiting jobs.
+   */
+  int queueSize() const;
+
+  /*! \brief Returns the highest number of waiting jobs so far.
+   */
+  int peakQueueSize() const;
+
+  /*! \brief Returns the number of jobs being executed.
+   */
+  int activeCount() const;
+
+  /*! \brief Returns the number of jobs executed so far.
+   */
+  long long completedCount() const;
+
+  /*! \brief Returns the number of jobs rejected so far.
+   *
+   * A job is rejected when it is posted while the queue is full.
+   */
+  long long rejectedCount() const;
+
+private:
+  int threadCount_, maximumQueueSize_;
+  std::deque<std::function<void ()> > queue_;
+  int peakQueueSize_, active_;
+  long long completed_, rejected_;
+  bool stopping_;
+
+#ifdef WT_THREADED
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<std::thread> threads_;
+#endif // WT_THREADED
+
+  void run();
+  void execute(const std::function<void ()>& job);
+};
+
+  }
+}
+
+#endif // WT_AUTH_PASSWORD_HASHING_POOL_H_
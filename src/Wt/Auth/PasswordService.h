@@ -9,6 +9,7 @@
 
 #include "Wt/Auth/AbstractPasswordService.h"
 #include "Wt/Auth/AuthThrottle.h"
+#include "Wt/Auth/PasswordHashingPool.h"
 
 #include "Wt/WDllDefs.h"
 #include "Wt/WValidator.h"
@@ -41,6 +42,10 @@ namespace Wt {
  * Password strength validation of a new user-chosen password may be
  * implemented by setting an AbstractStrengthValidator.
  *
+ * Password hashes are expensive to compute. To keep them from
+ * occupying the server threads, the service can be configured with a
+ * PasswordHashingPool, which is used by verifyPasswordAsync().
+ *
  * \ingroup auth
  */
 class WT_API PasswordService : public AbstractPasswordService
@@ -153,6 +158,27 @@ public:
   WT_DEPRECATED("Use setPasswordThrottle(std::unique_ptr<AuthThrottle>) instead")
   void setAttemptThrottlingEnabled(bool enabled);
 
+  /*! \brief Sets a thread pool for computing password hashes.
+   *
+   * When set, verifyPasswordAsync() verifies the password in the
+   * threads of this pool, instead of in the server thread that
+   * handles the request, and calls back into the session using
+   * WServer::post(). When the pool's queue is full, the attempt is
+   * refused with PasswordResult::LoginThrottling.
+   *
+   * The default hashing pool is \c nullptr: then verifyPasswordAsync()
+   * is the same as verifyPassword().
+   *
+   * \sa verifyPasswordAsync()
+   */
+  void setHashingPool(std::unique_ptr<PasswordHashingPool> pool);
+
+  /*! \brief Returns the thread pool for computing password hashes.
+   *
+   * \sa setHashingPool()
+   */
+  PasswordHashingPool *hashingPool() const { return hashingPool_.get(); }
+
   /*! \brief Returns whether password attempt throttling is enabled.
    *
    * \sa setAttemptThrottlingEnabled()
@@ -177,9 +203,25 @@ public:
   virtual PasswordResult verifyPassword(const User& user,
                                         const WT_USTRING& password) const override;
 
+  /*! \brief Verifies a password for a given user, asynchronously.
+   *
+   * \copydetails AbstractPasswordService::verifyPasswordAsync()
+   *
+   * The password is verified in the hashing pool, if one is
+   * configured, and when called from within a session. The user
+   * database is only accessed from within the session.
+   *
+   * \sa setHashingPool()
+   */
+  virtual void verifyPasswordAsync
+    (const User& user, const WT_USTRING& password,
+     const std::function<void (PasswordResult)>& callback)
+    const override;
+
   /*! \brief Sets a new password for the given user.
    *
-   * This stores a new password for the user in the database.
+   * This stores a new password for the user in the database, and
+   * removes the user's tokens from the AuthService::authTokenCache().
    */
   virtual void updatePassword(const User& user, const WT_USTRING& password)
     const override;
@@ -199,6 +241,11 @@ private:
   std::unique_ptr<AbstractVerifier> verifier_;
   std::unique_ptr<AbstractStrengthValidator> validator_;
   std::unique_ptr<AuthThrottle> passwordThrottle_;
+  std::unique_ptr<PasswordHashingPool> hashingPool_;
+
+  void completeVerification
+    (const User& user, bool valid, const PasswordHash& updatedHash,
+     const std::function<void (PasswordResult)>& callback) const;
 };
 
   }
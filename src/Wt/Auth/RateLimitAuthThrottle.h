@@ -0,0 +1,96 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_AUTH_RATE_LIMIT_AUTH_THROTTLE_H_
+#define WT_AUTH_RATE_LIMIT_AUTH_THROTTLE_H_
+
+#include <Wt/Auth/AuthThrottle.h>
+#include <Wt/Auth/AuthAttemptStore.h>
+
+#include <memory>
+#include <string>
+
+namespace Wt {
+  namespace Auth {
+
+/*! \class RateLimitAuthThrottle Wt/Auth/RateLimitAuthThrottle.h Wt/Auth/RateLimitAuthThrottle.h
+ *  \brief A throttle that keeps the failed attempts in an attempt store.
+ *
+ * The default AuthThrottle computes the delay from the attempt counts
+ * in the user database, which costs a database read for every attempt
+ * and a database write for every failed attempt.
+ *
+ * This throttle instead counts the failed attempts in an
+ * AuthAttemptStore, such as a SharedMemoryAttemptStore that is shared
+ * between the processes of a deployment. Failed attempts are not
+ * written to the user database; a successful attempt still is (see
+ * User::setAuthenticated()).
+ *
+ * Failed attempts are counted both for the user and for the client
+ * address (WEnvironment::clientAddress()) of the session. The delay
+ * is the largest of the delays computed by getAuthenticationThrottle()
+ * for the user, and by getAddressThrottle() for the client address. A
+ * successful attempt only resets the count for the user.
+ *
+ * The store may be shared by several throttles (for example for
+ * password and for MFA authentication), which use a different \p
+ * scope to keep their counts apart.
+ *
+ * \ingroup auth
+ */
+class WT_API RateLimitAuthThrottle : public AuthThrottle
+{
+public:
+  /*! \brief Constructor.
+   */
+  explicit RateLimitAuthThrottle(std::shared_ptr<AuthAttemptStore> store,
+                                 const std::string& scope = "auth");
+
+  /*! \brief Returns the store.
+   */
+  AuthAttemptStore *store() const { return store_.get(); }
+
+  /*! \brief Returns the scope.
+   */
+  const std::string& scope() const { return scope_; }
+
+  virtual int delayForNextAttempt(const User& user) const override;
+  virtual void recordAttempt(const User& user, bool success) const override;
+
+  /*! \brief Returns the number of seconds a client needs to wait
+   *         between two authentication attempts, given the amount
+   *         of recent failed attempts from its address.
+   *
+   * Since many users may share an address, the default
+   * implementation is more lenient than getAuthenticationThrottle():
+   * it returns 0 for less than 10 failed attempts, and
+   * getAuthenticationThrottle(failedAttempts - 9) otherwise.
+   */
+  virtual int getAddressThrottle(int failedAttempts) const;
+
+protected:
+  /*! \brief Returns the key for a user.
+   */
+  virtual std::string userKey(const User& user) const;
+
+  /*! \brief Returns the key for the client address.
+   *
+   * Returns an empty string when there is no session, in which case
+   * attempts are only counted for the user.
+   */
+  virtual std::string addressKey() const;
+
+private:
+  std::shared_ptr<AuthAttemptStore> store_;
+  std::string scope_;
+
+  int delay(const std::string& key, bool address) const;
+};
+
+  }
+}
+
+#endif // WT_AUTH_RATE_LIMIT_AUTH_THROTTLE_H_
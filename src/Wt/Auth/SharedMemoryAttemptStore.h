@@ -0,0 +1,129 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_AUTH_SHARED_MEMORY_ATTEMPT_STORE_H_
+#define WT_AUTH_SHARED_MEMORY_ATTEMPT_STORE_H_
+
+#include <Wt/Auth/AuthAttemptStore.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace Wt {
+  namespace Auth {
+
+/*! \class SharedMemoryAttemptStore Wt/Auth/SharedMemoryAttemptStore.h Wt/Auth/SharedMemoryAttemptStore.h
+ *  \brief An attempt store in (shared) memory.
+ *
+ * The failed attempts are kept in a fixed-size, lock-free hash table.
+ * When the store is given a name, the table is placed in a named
+ * shared memory segment, and all processes on the host that open a
+ * store with the same name share the counts. This is how throttling
+ * can be made to work across the processes of a multi-process
+ * deployment of wthttpd:
+ *
+ * \code
+ * auto store = std::make_shared<Auth::SharedMemoryAttemptStore>("myapp-auth");
+ * passwordService.setPasswordThrottle
+ *   (std::make_unique<Auth::RateLimitAuthThrottle>(store));
+ * \endcode
+ *
+ * Each key is counted in a sliding window (see window()): the count
+ * is estimated from the failures in the current and previous window
+ * period, weighting the latter by how much of it still overlaps with
+ * the window. Keys are stored as a 64-bit SipHash, keyed with a
+ * random seed that is created with the table, so that the slots of
+ * keys cannot be predicted by a client that wants to evict other keys.
+ *
+ * The table holds a fixed number of keys (see slots()). When a key
+ * cannot be placed, the key with the oldest failure nearby is
+ * evicted. The counts are thus approximate under heavy contention,
+ * which is acceptable for rate limiting.
+ *
+ * All processes using the same name should use the same size and
+ * window. The shared memory segment outlives the processes, and may
+ * be removed using remove().
+ *
+ * \ingroup auth
+ */
+class WT_API SharedMemoryAttemptStore : public AuthAttemptStore
+{
+public:
+  /*! \brief Constructor.
+   *
+   * Opens (or creates) the shared memory segment \p name, holding
+   * \p slots keys, counting failures within the given \p window.
+   *
+   * If \p name is empty, the table is private to this process.
+   *
+   * Throws a WException if the shared memory segment cannot be
+   * created or opened.
+   */
+  explicit SharedMemoryAttemptStore(const std::string& name = std::string(),
+                                    int slots = 65536,
+                                    std::chrono::seconds window
+                                    = std::chrono::minutes(15));
+
+  SharedMemoryAttemptStore(const SharedMemoryAttemptStore&) = delete;
+  SharedMemoryAttemptStore& operator=(const SharedMemoryAttemptStore&)
+    = delete;
+
+  /*! \brief Destructor.
+   *
+   * Unmaps the shared memory segment, which is not removed.
+   */
+  virtual ~SharedMemoryAttemptStore();
+
+  /*! \brief Returns the name.
+   */
+  const std::string& name() const { return name_; }
+
+  /*! \brief Returns the number of keys that can be stored.
+   */
+  int slots() const { return slots_; }
+
+  /*! \brief Returns the window within which failures are counted.
+   */
+  std::chrono::seconds window() const { return window_; }
+
+  virtual Attempts attempts(const std::string& key) const override;
+  virtual void addFailure(const std::string& key) override;
+  virtual void reset(const std::string& key) override;
+
+  /*! \brief Removes a shared memory segment.
+   *
+   * Processes that have the segment open keep using it, but a store
+   * that is opened later creates a new segment.
+   */
+  static void remove(const std::string& name);
+
+private:
+  struct Header;
+  struct Slot;
+
+  std::string name_;
+  int slots_;
+  std::chrono::seconds window_;
+  void *memory_;
+  std::size_t size_;
+#ifdef WT_WIN32
+  void *handle_;
+#endif // WT_WIN32
+
+  Header *header() const;
+  Slot *slot(int i) const;
+  Slot *find(std::uint64_t hash) const;
+  Slot *claim(std::uint64_t hash);
+
+  std::uint64_t hash(const std::string& key) const;
+  static std::string segmentName(const std::string& name);
+};
+
+  }
+}
+
+#endif // WT_AUTH_SHARED_MEMORY_ATTEMPT_STORE_H_
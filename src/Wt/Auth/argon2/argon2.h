@@ -0,0 +1,45 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_AUTH_ARGON2_H_
+#define WT_AUTH_ARGON2_H_
+
+#include "Wt/WDllDefs.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Wt {
+  namespace Auth {
+    namespace Argon2 {
+
+/*
+ * Computes the BLAKE2b hash (unkeyed) of data, with an output length
+ * of 1 to 64 bytes.
+ */
+extern WT_API std::string blake2b(const std::string& data, std::size_t outLength);
+
+/*
+ * Computes the Argon2id (version 0x13) tag, as specified by RFC 9106.
+ *
+ * The memory cost is in KiB. The lanes are computed sequentially.
+ */
+extern WT_API std::string argon2id(const std::string& password,
+                                   const std::string& salt,
+                                   std::uint32_t memoryCost,
+                                   std::uint32_t iterations,
+                                   std::uint32_t parallelism,
+                                   std::uint32_t tagLength,
+                                   const std::string& secret = std::string(),
+                                   const std::string& associatedData
+                                     = std::string());
+
+    }
+  }
+}
+
+#endif // WT_AUTH_ARGON2_H_
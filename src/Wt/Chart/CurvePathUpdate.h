@@ -0,0 +1,40 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef CHART_CURVE_PATH_UPDATE_H_
+#define CHART_CURVE_PATH_UPDATE_H_
+
+#include <string>
+
+#include <Wt/WDllDefs.h>
+
+namespace Wt {
+
+class WPainterPath;
+
+  namespace Chart {
+
+/*
+ * Computes an incremental update of the client side value of a curve
+ * path, which is \p current, to \p path.
+ *
+ * When \p path extends \p current, possibly after a change of the axis
+ * ranges which only scales and translates the current segments,
+ * \p jsUpdate is set to a JavaScript expression that computes
+ * \p path from \p jsRef, using that transformation and the new
+ * segments. \p jsUpdate is left empty if \p path equals \p current.
+ *
+ * Returns false if \p path must be sent completely instead.
+ */
+extern WT_API bool curvePathUpdate(const WPainterPath& current,
+                                   const WPainterPath& path,
+                                   const std::string& jsRef,
+                                   std::string& jsUpdate);
+
+  }
+}
+
+#endif // CHART_CURVE_PATH_UPDATE_H_
@@ -265,6 +265,14 @@ protected:
 
   virtual void modelReset();
 
+  /*! \brief Called when rows were appended to the model.
+   *
+   * The default implementation calls modelReset().
+   *
+   * \sa WAbstractChartModel::rowsAppended()
+   */
+  virtual void modelRowsAppended(int firstRow);
+
 private:
   template <typename T>
   void set(T& m, const T& v);
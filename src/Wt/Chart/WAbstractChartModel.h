@@ -167,11 +167,31 @@ public:
   /*! \brief A signal that notifies of any change to the model.
    *
    * Implementations should trigger this signal in order to update the chart.
+   *
+   * This signal is not emitted for rows that are appended to the
+   * model when rowsAppended() is emitted instead, as
+   * WStandardChartProxyModel does. Code that connects to changed() to
+   * be notified of all changes should also connect to rowsAppended().
+   *
+   * \sa rowsAppended()
    */
   virtual Signal<>& changed() { return changed_; }
 
+  /*! \brief A signal that notifies that rows were appended.
+   *
+   * The argument is the index of the first new row. Implementations
+   * may trigger this signal instead of changed() when rows were
+   * appended without changing the existing rows, which allows the
+   * chart to update incrementally.
+   *
+   * WStandardChartProxyModel triggers this signal for rows that are
+   * inserted at the end of the source model.
+   */
+  virtual Signal<int>& rowsAppended() { return rowsAppended_; }
+
 private:
   Signal<> changed_;
+  Signal<int> rowsAppended_;
 };
 
   }
@@ -1312,6 +1312,14 @@ public:
    * These methods allow to activate the client side interactive features of
    * a %WCartesianChart.
    *
+   * An interactive chart keeps the paths of line and curve series on
+   * the client. When rows are appended to the model, only the new
+   * segments of these paths are sent to the client, together with the
+   * scaling of the existing segments when the axis ranges changed. For
+   * a series that is shown in full (i.e. without on-demand loading,
+   * downsampling or a logarithmic axis), an update then no longer
+   * grows with the number of rows that were already shown.
+   *
    * \note Client side interaction is only available if the chart is drawn
    *       on an HTML canvas. This is the default rendering method on
    *       modern browsers, see WPaintedWidget::setPreferredMethod()
@@ -1783,6 +1791,7 @@ private:
 protected:
   virtual void modelChanged() override;
   virtual void modelReset() override;
+  virtual void modelRowsAppended(int firstRow) override;
 
   /** @name Rendering logic
    */
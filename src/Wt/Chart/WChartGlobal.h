@@ -66,6 +66,18 @@ enum class FillRangeType {
   ZeroValue     //!< Fill from the curve to the zero Y value.
 };
 
+/*! \brief Enumeration that indicates how a data series is downsampled.
+ *
+ * \sa WDataSeries::setDownsampling()
+ *
+ * \ingroup charts
+ */
+enum class Downsampling {
+  None,   //!< All points are rendered.
+  MinMax, //!< The minimum and maximum value per pixel are rendered.
+  LTTB    //!< Largest-Triangle-Three-Buckets: one point per pixel.
+};
+
 /*! \brief Enumeration type that indicates a chart type for a cartesian
  *         chart.
  *
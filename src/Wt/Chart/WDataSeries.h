@@ -585,6 +585,48 @@ public:
    */
   std::shared_ptr<WAbstractChartModel> model() const;
 
+  /*! \brief Sets the downsampling method.
+   *
+   * When a series has many more points than pixels in the zoomed
+   * range of its X axis, downsampling reduces the points that are
+   * rendered to a few per pixel:
+   * - Downsampling::MinMax renders the points with the minimum and
+   *   maximum Y value for every pixel, which preserves the envelope
+   *   of the data.
+   * - Downsampling::LTTB renders a single point for every pixel using
+   *   the Largest-Triangle-Three-Buckets algorithm, which preserves the
+   *   visual shape of the data.
+   *
+   * The minimum and maximum Y values of consecutive blocks of 16 rows,
+   * and of blocks of twice, four times, ... that size are computed
+   * once and cached. When rows are appended to the model (see
+   * WAbstractChartModel::rowsAppended()), only the last blocks are
+   * computed again. The LTTB algorithm is applied to the minimum and
+   * maximum values of blocks that are 8 times smaller than a pixel.
+   *
+   * Downsampling applies only to series that are not stacked and are
+   * not of type SeriesType::Bar, and assumes that X values increase
+   * with the row number. It is applied only when there are more than
+   * 16 rows per pixel. Combine it with
+   * WCartesianChart::setOnDemandLoadingEnabled() to render the data
+   * again as the user zooms in.
+   *
+   * Downsampling is skipped for an interactive chart, i.e. one that is
+   * rendered to a canvas with zooming, panning, a crosshair or another
+   * client-side interaction enabled, unless on-demand loading is also
+   * enabled. Without on-demand loading, the client zooms in on the
+   * data that was sent, and would reveal the missing points.
+   *
+   * The default value is Downsampling::None.
+   */
+  void setDownsampling(Downsampling method);
+
+  /*! \brief Returns the downsampling method.
+   *
+   * \sa setDownsampling()
+   */
+  Downsampling downsampling() const { return downsampling_; }
+
   WCartesianChart *chart() { return chart_; }
 
 private:
@@ -614,12 +656,30 @@ private:
   double             scale_;
   mutable bool       offsetDirty_;
   mutable bool       scaleDirty_;
+  Downsampling       downsampling_;
+
+  // Minimum and maximum Y value for blocks of rows, per level
+  struct DownsamplingBucket {
+    int minRow, maxRow;
+    double minY, maxY;
+  };
+
+  mutable std::vector<std::vector<DownsamplingBucket> > downsamplingLevels_;
+  mutable const WAbstractChartModel *downsamplingModel_;
+  mutable int downsamplingColumn_;
+  mutable int downsamplingRows_;
 
   // connections with the current model, used to disconnect from a model
   // when the model changes.
   std::vector<Wt::Signals::connection> modelConnections_;
 
   void modelReset();
+  void modelRowsAppended(int firstRow);
+
+  void invalidateDownsampling();
+  void updateDownsampling() const;
+  bool downsampledRows(std::vector<int>& rows, int startRow, int endRow,
+                       double rowsPerPixel, int xColumn) const;
 
   template <typename T>
   bool set(T& m, const T& v);
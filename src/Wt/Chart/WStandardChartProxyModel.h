@@ -178,6 +178,7 @@ private:
 #endif
 
   void sourceModelModified();
+  void sourceModelRowsInserted(const WModelIndex& parent, int first, int last);
   const WColor *color(int row, int column, ItemDataRole colorRole) const;
 };
 
@@ -10,6 +10,8 @@
 #include <Wt/WAbstractTableModel.h>
 #include <Wt/Dbo/Dbo.h>
 
+#include <functional>
+
 namespace Wt {
   namespace Dbo {
 
@@ -20,7 +22,9 @@ class QueryColumn;
  *
  * The model fetches results from the query and presents the data in a
  * table. It supports sorting the underlying SQL query using
- * Query::orderBy().
+ * Query::orderBy(), and filtering it using Query::where() (see
+ * setFilter()), so that both are done by the database rather than in
+ * memory.
  *
  * The default implementation of data() converts %Query results to
  * model data using query_result_traits<Result>::getValues(). You may
@@ -67,6 +71,9 @@ class QueryColumn;
  * you are only interested in rowCount(), not the actual data) then
  * you can avoid this behaviour by setting batchSize to 0.
  *
+ * For large tables, consider enabling setKeysetPaging(), which
+ * fetches the next batch of rows while scrolling without an offset.
+ *
  * \ingroup dbo modelview
  */
 template <class Result>
@@ -225,6 +232,129 @@ public:
    */
   int batchSize() const { return batchSize_; }
 
+  /*! \brief Sets a filter.
+   *
+   * The \p condition is added as an additional <i>where</i>
+   * condition to the query (see Query::where()), and every
+   * <tt>?</tt> placeholder in \p condition is bound to the
+   * corresponding value in \p values. The rows are thus filtered by
+   * the database, without fetching any rows that do not match the
+   * filter. For example:
+   *
+   * \code
+   * model->setFilter("p.price > ? and p.artist = ?", 1000,
+   *                  std::string("Vermeer"));
+   * \endcode
+   *
+   * The filter replaces a previously set filter, and is kept when the
+   * query is changed with setQuery(). The filter condition is added
+   * after the conditions of the query itself, so the query itself
+   * should not bind values for <i>having</i> or <i>order by</i>
+   * clauses.
+   *
+   * Use an empty \p condition to remove the filter.
+   *
+   * Like reload(), this invalidates the cached data and row count.
+   */
+  template <typename... T>
+  void setFilter(const std::string& condition, const T&... values);
+
+  /*! \brief Returns the filter condition.
+   *
+   * \sa setFilter()
+   */
+  const std::string& filter() const { return filter_; }
+
+  /*! \brief Enables keyset paging.
+   *
+   * By default, the model fetches a batch of rows using an
+   * <i>offset</i> and <i>limit</i>. Since the database still needs to
+   * produce all rows that are skipped by the offset, this gets slower
+   * as a view scrolls further down a large table.
+   *
+   * With keyset paging enabled, a batch that directly follows a
+   * previously fetched row is fetched with a <i>where</i> condition
+   * that starts after the sort key of that row instead, which the
+   * database can serve from an index. This requires that the result
+   * has a surrogate id (see resultId()), which is added to the
+   * <i>order by</i> clause to break ties. When the model is not
+   * sorted, the rows are ordered on this id.
+   *
+   * The model falls back to an offset when jumping to a row that does
+   * not follow a cached row, when the model is sorted using a
+   * customized createOrderBy(), when the sort key of the previous row
+   * is null or of a type that cannot be bound (only numeric, boolean,
+   * string and std::chrono time point values are supported), and when
+   * the query itself has a limit or offset.
+   *
+   * Keyset paging is disabled by default.
+   */
+  void setKeysetPaging(bool enabled);
+
+  /*! \brief Returns whether keyset paging is enabled.
+   *
+   * \sa setKeysetPaging()
+   */
+  bool keysetPaging() const { return keysetPaging_; }
+
+  /*! \brief Sets a row count estimator.
+   *
+   * Counting the rows of a large table requires the database to scan
+   * the entire table (or index), and rowCount() needs the count before
+   * a view can be rendered.
+   *
+   * When an \p estimator is set, and the first batch of rows does not
+   * already reveal the row count, rowCount() returns the value of the
+   * \p estimator rather than counting the rows. The exact count is
+   * deferred, but not asynchronous: within a session it is posted
+   * (see WServer::post()), and runs later on the session's thread,
+   * after the current request has been handled. The view is then
+   * corrected with a rowsInserted() or rowsRemoved() signal, which is
+   * pushed to the browser if server push is enabled (see
+   * WApplication::enableUpdates()). Outside of a session, call
+   * countRows() to replace the estimate with the exact count.
+   *
+   * When a batch that is fetched while the estimate is used returns
+   * fewer rows than requested, the end of the rows is known: the
+   * estimate is then replaced by the exact count right away, emitting
+   * rowsRemoved() (or rowsInserted()). Until then, data() returns
+   * empty data for rows beyond the actual rows.
+   *
+   * The estimator could for example use the statistics of the
+   * database. For example, with PostgreSQL:
+   *
+   * \code
+   * model->setRowCountEstimator([session] {
+   *   Wt::Dbo::Transaction t(*session);
+   *   return session->query<int>("select cast(reltuples as integer) from pg_class")
+   *     .where("relname = ?").bind(std::string("audit_log"))
+   *     .resultValue();
+   * });
+   * \endcode
+   *
+   * An \p estimator may return -1 if it has no estimate, in which case
+   * the rows are counted right away.
+   *
+   * \sa rowCountIsEstimate()
+   */
+  void setRowCountEstimator(const std::function<int ()>& estimator);
+
+  /*! \brief Returns whether rowCount() currently returns an estimate.
+   *
+   * \sa setRowCountEstimator()
+   */
+  bool rowCountIsEstimate() const { return rowCountEstimated_; }
+
+  /*! \brief Counts the rows.
+   *
+   * If rowCount() currently returns an estimate, this counts the rows
+   * and corrects the row count, emitting rowsInserted() or
+   * rowsRemoved() when it differs from the estimate.
+   *
+   * \sa setRowCountEstimator()
+   */
+  void countRows();
+
   /*! \brief Returns the query field list.
    *
    * This returns the field list from the underlying query.
@@ -422,17 +552,36 @@ protected:
 
 private:
   void cacheRow(int row) const;
+  bool fetchAfter(int row, int limit, std::vector<Result>& results) const;
+  int idFieldIndex() const;
+  std::string orderBy() const;
+  int exactRowCount() const;
+  void scheduleRowCount() const;
+  void setExactRowCount(int count);
+  void updateQuery();
+  static bool bindKey(Query<Result>& query, const cpp17::any& value);
 
   typedef std::vector<cpp17::any> AnyList;
   typedef std::map<int, long long> StableResultIdMap;
 
   std::vector<QueryColumn> columns_;
 
+  Query<Result> baseQuery_;
   mutable Query<Result> query_;
   int queryLimit_, queryOffset_, batchSize_;
   mutable std::string sortOrderBy_;
 
+  std::string filter_;
+  std::function<void (Query<Result>&)> filterBinder_;
+
+  bool keysetPaging_;
+  int keysetSortField_;
+  SortOrder keysetSortOrder_;
+
+  std::function<int ()> rowCountEstimator_;
+
   mutable int cachedRowCount_;
+  mutable bool rowCountEstimated_;
   mutable int cacheStart_;
   mutable std::vector<Result> cache_;
 
@@ -9,6 +9,8 @@
 
 #include <Wt/Dbo/QueryModel.h>
 #include <Wt/Dbo/QueryColumn.h>
+#include <Wt/WApplication.h>
+#include <Wt/WServer.h>
 
 #include <string>
 
@@ -18,7 +20,11 @@ namespace Wt {
 template <class Result>
 QueryModel<Result>::QueryModel()
   : batchSize_(40),
+    keysetPaging_(false),
+    keysetSortField_(-1),
+    keysetSortOrder_(SortOrder::Ascending),
     cachedRowCount_(-1),
+    rowCountEstimated_(false),
     cacheStart_(-1),
     currentRow_(-1)
 { }
@@ -31,22 +37,101 @@ void QueryModel<Result>::setQuery(const Query<Result>& query,
   queryOffset_ = query.offset();
 
   if (!keepColumns) {
-    query_ = query;
-    fields_ = query_.fields();
+    baseQuery_ = query;
+    fields_ = baseQuery_.fields();
     columns_.clear();
     sortOrderBy_.clear();
+    keysetSortField_ = -1;
+    keysetSortOrder_ = SortOrder::Ascending;
+    updateQuery();
     reset();
   } else {
     invalidateData();
-    query_ = query;
-    fields_ = query_.fields();
-    if (!sortOrderBy_.empty()) {
-      query_.orderBy(sortOrderBy_);
-    }
+    baseQuery_ = query;
+    fields_ = baseQuery_.fields();
+    updateQuery();
+    dataReloaded();
+  }
+}
+
+template <class Result>
+template <typename... T>
+void QueryModel<Result>::setFilter(const std::string& condition,
+                                   const T&... values)
+{
+  filter_ = condition;
+
+  if (condition.empty())
+    filterBinder_ = nullptr;
+  else
+    filterBinder_ = [values...](Query<Result>& query) {
+      (query.bind(values), ...);
+    };
+
+  invalidateData();
+  updateQuery();
+  dataReloaded();
+}
+
+template <class Result>
+void QueryModel<Result>::setKeysetPaging(bool enabled)
+{
+  if (keysetPaging_ != enabled) {
+    invalidateData();
+    keysetPaging_ = enabled;
+    updateQuery();
     dataReloaded();
   }
 }
 
+template <class Result>
+void QueryModel<Result>::updateQuery()
+{
+  query_ = baseQuery_;
+
+  if (!filter_.empty()) {
+    query_.where(filter_);
+    filterBinder_(query_);
+  }
+
+  std::string o = orderBy();
+  if (!o.empty())
+    query_.orderBy(o);
+}
+
+template <class Result>
+std::string QueryModel<Result>::orderBy() const
+{
+  /*
+   * With keyset paging, the id is added to break ties, unless the
+   * order by clause was customized (keysetSortField_ == -2)
+   */
+  if (!keysetPaging_ || keysetSortField_ == -2)
+    return sortOrderBy_;
+
+  int idField = idFieldIndex();
+  if (idField == -1)
+    return sortOrderBy_;
+
+  std::string id = fields_[idField].sql()
+    + (keysetSortOrder_ == SortOrder::Ascending ? " asc" : " desc");
+
+  if (sortOrderBy_.empty())
+    return id;
+  else
+    return sortOrderBy_ + ", " + id;
+}
+
+template <class Result>
+int QueryModel<Result>::idFieldIndex() const
+{
+  for (unsigned i = 0; i < fields_.size(); ++i)
+    if (fields_[i].isSurrogateIdField())
+      return i;
+
+  return -1;
+}
+
 template <class Result>
 Query<Result> QueryModel<Result>::query() const
 {
@@ -122,20 +207,93 @@ int QueryModel<Result>::rowCount(const WModelIndex& parent) const
       cacheRow(0);
 
     if (cachedRowCount_ == -1) {
-      Transaction transaction(query_.session());
+      int estimate = rowCountEstimator_ ? rowCountEstimator_() : -1;
+
+      if (estimate >= 0) {
+        /*
+         * At least the rows of the first batch exist
+         */
+        if (cacheStart_ == 0)
+          estimate = std::max(estimate, static_cast<int>(cache_.size()));
+
+        cachedRowCount_ = estimate;
+        rowCountEstimated_ = true;
+        scheduleRowCount();
+      } else
+        cachedRowCount_ = exactRowCount();
+    }
+  }
+
+  return cachedRowCount_;
+}
+
+template <class Result>
+int QueryModel<Result>::exactRowCount() const
+{
+  Transaction transaction(query_.session());
 
-      query_.limit(queryLimit_);
-      query_.offset(queryOffset_);
+  query_.limit(queryLimit_);
+  query_.offset(queryOffset_);
 
-      Query<Result> unorderedQuery(query_);
-      unorderedQuery.orderBy("");
-      cachedRowCount_ = static_cast<int>(unorderedQuery.resultList().size());
+  Query<Result> unorderedQuery(query_);
+  unorderedQuery.orderBy("");
+  int result = static_cast<int>(unorderedQuery.resultList().size());
 
-      transaction.commit();
-    }
+  transaction.commit();
+
+  return result;
+}
+
+template <class Result>
+void QueryModel<Result>::setRowCountEstimator
+  (const std::function<int ()>& estimator)
+{
+  rowCountEstimator_ = estimator;
+}
+
+template <class Result>
+void QueryModel<Result>::scheduleRowCount() const
+{
+  WApplication *app = WApplication::instance();
+  WServer *server = WServer::instance();
+
+  if (app && server) {
+    QueryModel<Result> *self = const_cast<QueryModel<Result> *>(this);
+    server->post(app->sessionId(), self->bindSafe([self]() {
+          self->countRows();
+
+          WApplication *app = WApplication::instance();
+          if (app)
+            app->triggerUpdate();
+        }));
   }
+}
 
-  return cachedRowCount_;
+template <class Result>
+void QueryModel<Result>::countRows()
+{
+  if (!rowCountEstimated_)
+    return;
+
+  setExactRowCount(exactRowCount());
+}
+
+template <class Result>
+void QueryModel<Result>::setExactRowCount(int count)
+{
+  int estimate = cachedRowCount_;
+
+  rowCountEstimated_ = false;
+
+  if (count > estimate) {
+    beginInsertRows(WModelIndex(), estimate, count - 1);
+    cachedRowCount_ = count;
+    endInsertRows();
+  } else if (count < estimate) {
+    beginRemoveRows(WModelIndex(), count, estimate - 1);
+    cachedRowCount_ = count;
+    endRemoveRows();
+  }
 }
 
 template <class Result>
@@ -147,6 +305,12 @@ WFlags<ItemFlag> QueryModel<Result>::flags(const WModelIndex& index) const
 template <class Result>
 cpp17::any QueryModel<Result>::data(const WModelIndex& index, ItemDataRole role) const
 {
+  if (rowCountEstimated_) {
+    cacheRow(index.row());
+    if (index.row() >= cacheStart_ + static_cast<int>(cache_.size()))
+      return cpp17::any();
+  }
+
   setCurrentRow(index.row());
 
   if (role == ItemDataRole::Display || role == ItemDataRole::Edit)
@@ -205,6 +369,7 @@ void QueryModel<Result>::invalidateData()
   layoutAboutToBeChanged().emit();
 
   cachedRowCount_ = cacheStart_ = currentRow_ = -1;
+  rowCountEstimated_ = false;
   cache_.clear();
   rowValues_.clear();
   stableIds_.clear();
@@ -223,13 +388,22 @@ void QueryModel<Result>::sort(int column, SortOrder order)
    * This should not change the row count
    */
   int rc = cachedRowCount_;
+  bool estimated = rowCountEstimated_;
 
   invalidateData();
 
   sortOrderBy_ = createOrderBy(column, order);
-  query_.orderBy(sortOrderBy_);
+
+  if (sortOrderBy_ == QueryModel<Result>::createOrderBy(column, order))
+    keysetSortField_ = columns_[column].fieldIdx_;
+  else
+    keysetSortField_ = -2;
+  keysetSortOrder_ = order;
+
+  query_.orderBy(orderBy());
 
   cachedRowCount_ = rc;
+  rowCountEstimated_ = estimated;
   dataReloaded();
 }
 
@@ -281,22 +455,28 @@ void QueryModel<Result>::cacheRow(int row) const
 {
   if (row < cacheStart_
       || row >= cacheStart_ + static_cast<int>(cache_.size())) {
-    cacheStart_ = std::max(std::min(row - batchSize_ / 4, cachedRowCount_ - batchSize_), 0);
-    int qOffset = cacheStart_;
+    int start = std::max(std::min(row - batchSize_ / 4, cachedRowCount_ - batchSize_), 0);
+    int qOffset = start;
     if (queryOffset_ > 0)
       qOffset += queryOffset_;
-    query_.offset(qOffset);
 
     int qLimit = batchSize_;
     if (queryLimit_ > 0)
-      qLimit = std::min(batchSize_, queryLimit_ - cacheStart_);
-    query_.limit(qLimit);
+      qLimit = std::min(batchSize_, queryLimit_ - start);
 
     Transaction transaction(query_.session());
 
-    collection<Result> results = query_.resultList();
-    cache_.clear();
-    cache_.insert(cache_.end(), results.begin(), results.end());
+    std::vector<Result> results;
+    if (!fetchAfter(start, qLimit, results)) {
+      query_.offset(qOffset);
+      query_.limit(qLimit);
+
+      collection<Result> c = query_.resultList();
+      results.assign(c.begin(), c.end());
+    }
+
+    cacheStart_ = start;
+    cache_.swap(results);
 
     for (unsigned i = 0; i < cache_.size(); ++i) {
       long long id = resultId(cache_[i]);
@@ -307,10 +487,120 @@ void QueryModel<Result>::cacheRow(int row) const
         && qOffset == 0 && cachedRowCount_ == -1)
       cachedRowCount_ = cache_.size();
 
+    /*
+     * A short batch reveals where the rows end: correct the estimate
+     * now rather than querying again for every row beyond the end
+     */
+    int count = -1;
+    if (rowCountEstimated_ && static_cast<int>(cache_.size()) < qLimit) {
+      if (cache_.empty() && start > 0)
+        count = exactRowCount();
+      else
+        count = cacheStart_ + static_cast<int>(cache_.size());
+    }
+
     transaction.commit();
+
+    if (count != -1)
+      const_cast<QueryModel<Result> *>(this)->setExactRowCount(count);
   }
 }
 
+template <class Result>
+bool QueryModel<Result>::fetchAfter(int row, int limit,
+                                    std::vector<Result>& results) const
+{
+  /*
+   * Fetches the rows starting at row, using the sort key of the
+   * previous row when it is cached, instead of an offset.
+   */
+  if (!keysetPaging_ || keysetSortField_ == -2
+      || queryLimit_ > 0 || queryOffset_ > 0
+      || row <= cacheStart_
+      || row > cacheStart_ + static_cast<int>(cache_.size()))
+    return false;
+
+  int idField = idFieldIndex();
+  if (idField == -1)
+    return false;
+
+  const Result& previous = cache_[row - 1 - cacheStart_];
+  long long id = resultId(previous);
+  if (id == -1)
+    return false;
+
+  const char *op = keysetSortOrder_ == SortOrder::Ascending ? " > ?" : " < ?";
+  std::string idSql = fields_[idField].sql();
+
+  Query<Result> query(query_);
+
+  if (keysetSortField_ == -1) {
+    query.where(idSql + op);
+  } else {
+    AnyList values;
+    query_result_traits<Result>::getValues(previous, values);
+    const cpp17::any& key = values[keysetSortField_];
+
+    std::string keySql = fields_[keysetSortField_].sql();
+    query.where("(" + keySql + op + ") or (" + keySql + " = ? and "
+                + idSql + op + ")");
+    if (!bindKey(query, key) || !bindKey(query, key))
+      return false;
+  }
+
+  query.bind(id);
+  query.offset(-1);
+  query.limit(limit);
+
+  collection<Result> c = query.resultList();
+  results.assign(c.begin(), c.end());
+
+  /*
+   * Rows with a null sort key are excluded by the condition, and may
+   * still follow depending on how the database sorts nulls: fall back
+   * to an offset to be sure.
+   */
+  if (static_cast<int>(results.size()) < limit) {
+    results.clear();
+    return false;
+  }
+
+  return true;
+}
+
+template <class Result>
+bool QueryModel<Result>::bindKey(Query<Result>& query,
+                                 const cpp17::any& value)
+{
+  if (!cpp17::any_has_value(value))
+    return false;
+
+  const std::type_info& t = value.type();
+
+  if (t == typeid(std::string))
+    query.bind(cpp17::any_cast<std::string>(value));
+  else if (t == typeid(int))
+    query.bind(cpp17::any_cast<int>(value));
+  else if (t == typeid(long long))
+    query.bind(cpp17::any_cast<long long>(value));
+  else if (t == typeid(long))
+    query.bind(cpp17::any_cast<long>(value));
+  else if (t == typeid(short))
+    query.bind(cpp17::any_cast<short>(value));
+  else if (t == typeid(bool))
+    query.bind(cpp17::any_cast<bool>(value));
+  else if (t == typeid(double))
+    query.bind(cpp17::any_cast<double>(value));
+  else if (t == typeid(float))
+    query.bind(cpp17::any_cast<float>(value));
+  else if (t == typeid(std::chrono::system_clock::time_point))
+    query.bind(cpp17::any_cast<std::chrono::system_clock::time_point>(value));
+  else
+    return false;
+
+  return true;
+}
+
 template <class Result>
 void QueryModel<Result>::invalidateRow(int row)
 {
@@ -319,7 +609,7 @@ void QueryModel<Result>::invalidateRow(int row)
 
   WModelIndex start = index(row, 0);
   WModelIndex end = index(row, columnCount() - 1);
-  dataChanged().emit(start, end);
+  notifyDataChanged(start, end);
 }
 
 template <class Result>
@@ -402,6 +692,8 @@ template <class Result>
 bool QueryModel<Result>::insertRows(int row, int count,
                                     const WModelIndex& parent)
 {
+  countRows();
+
   if (row != rowCount())
     throw Exception("QueryModel: only supporting row insertion at end");
 
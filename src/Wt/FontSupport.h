@@ -204,6 +204,13 @@ public:
    */
   void addFontCollection(const std::string& directory, bool recursive = true);
 
+  /*
+   * Forgets the fonts that were matched in font collection directories,
+   * which are cached for all instances. If libpango support is
+   * available, this is a no-op.
+   */
+  static void clearFontCollectionCache();
+
 #ifdef WT_FONTSUPPORT_DIRECTWRITE
   /*
    * Direct access to IDWriteFactory for WRasterImage-d2d1
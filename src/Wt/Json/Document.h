@@ -0,0 +1,300 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_JSON_DOCUMENT_H_
+#define WT_JSON_DOCUMENT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Wt/Json/Parser.h>
+#include <Wt/Json/Value.h>
+
+namespace Wt {
+  namespace Json {
+
+struct Member;
+
+/*! \class Node Wt/Json/Document.h Wt/Json/Document.h
+ *  \brief A read-only JSON value inside a Document.
+ *
+ * A node is a compact (16 byte) representation of a JSON value. Its
+ * contents (array elements, object members and strings) are stored
+ * in the arena of the Document that owns it, and thus a node is only
+ * valid as long as its document. Short strings are stored inside the
+ * node itself.
+ *
+ * Object members are kept in the order of the input. Looking up a
+ * member by name is a linear search, which for the typical small
+ * objects is faster than a tree or hash lookup; iterate over the
+ * members with member() when all of them are needed.
+ *
+ * Use toValue() to convert the node to a Value, for use with the
+ * existing API.
+ *
+ * \sa Document
+ *
+ * \ingroup json
+ */
+class WT_API Node
+{
+public:
+  /*! \brief Creates a \link Wt::Json::Type::Null Null\endlink node.
+   */
+  Node();
+
+  /*! \brief Returns the type.
+   */
+  Type type() const { return static_cast<Type>(type_); }
+
+  /*! \brief Returns whether this node is null.
+   *
+   * Missing object members and array elements are also null.
+   */
+  bool isNull() const { return type() == Type::Null; }
+
+  /*! \brief Returns the boolean value.
+   *
+   * \throws TypeException if the node is not a boolean.
+   */
+  bool toBool() const;
+
+  /*! \brief Returns the number value.
+   *
+   * \throws TypeException if the node is not a number.
+   */
+  double toNumber() const;
+
+  /*! \brief Returns the number value as an integer.
+   *
+   * \throws TypeException if the node is not a number.
+   */
+  long long toInt() const;
+
+  /*! \brief Returns the string value (UTF-8).
+   *
+   * \throws TypeException if the node is not a string.
+   */
+  std::string toString() const;
+
+  /*! \brief Returns the string data (UTF-8).
+   *
+   * This avoids copying the string. The data is not null-terminated.
+   *
+   * \throws TypeException if the node is not a string.
+   *
+   * \sa stringLength()
+   */
+  const char *stringData() const;
+
+  /*! \brief Returns the length of the string data.
+   *
+   * \throws TypeException if the node is not a string.
+   *
+   * \sa stringData()
+   */
+  std::size_t stringLength() const;
+
+  /*! \brief Returns the number of array elements or object members.
+   *
+   * Returns 0 for other types.
+   */
+  std::size_t size() const;
+
+  /*! \brief Returns an array element.
+   *
+   * Returns a null node if \p index is out of range.
+   *
+   * \throws TypeException if the node is not an array.
+   */
+  const Node& operator[](std::size_t index) const;
+
+  /*! \brief Returns an object member.
+   *
+   * Members are indexed in the order of the input.
+   *
+   * \throws TypeException if the node is not an object.
+   */
+  const Member& member(std::size_t index) const;
+
+  /*! \brief Returns the value of an object member.
+   *
+   * Returns a null node if the object does not contain the member.
+   *
+   * \throws TypeException if the node is not an object.
+   */
+  const Node& get(const std::string& name) const;
+
+  /*! \brief Returns the value of an object member.
+   *
+   * Returns \c nullptr if the object does not contain the member.
+   *
+   * \throws TypeException if the node is not an object.
+   */
+  const Node *find(const char *name, std::size_t length) const;
+
+  /*! \brief Returns whether the string value is equal to \p s.
+   *
+   * Returns \c false if the node is not a string.
+   */
+  bool equals(const char *s, std::size_t length) const;
+
+  /*! \brief Converts to a Value.
+   *
+   * This creates a deep copy of the node as a Value, Object or Array.
+   */
+  Value toValue() const;
+
+  /*! \brief Null node.
+   */
+  static const Node Null;
+
+private:
+  static const std::size_t SMALL_STRING_SIZE = 14;
+
+  // a pointer and a 32-bit size, a double, a bool, or a small string
+  alignas(8) char data_[SMALL_STRING_SIZE];
+  std::uint8_t type_;
+  std::uint8_t smallLength_;
+
+  static const std::uint8_t LARGE = 0xFF;
+
+  const void *pointer() const;
+  std::uint32_t count() const;
+  void set(Type type, const void *pointer, std::size_t count);
+  void checkType(Type type) const;
+
+  friend class Document;
+};
+
+/*! \brief A member of an object Node.
+ *
+ * \ingroup json
+ */
+struct WT_API Member
+{
+  /*! \brief The member name (a string node).
+   */
+  Node name;
+
+  /*! \brief The member value.
+   */
+  Node value;
+};
+
+/*! \class Document Wt/Json/Document.h Wt/Json/Document.h
+ *  \brief A parsed JSON document.
+ *
+ * A document is a faster, leaner alternative to parsing into a
+ * Value, for large inputs. It uses the streaming parser (see
+ * SaxHandler) and stores the result as Node objects in an arena: a
+ * few large memory blocks owned by the document, instead of one heap
+ * allocation for every value, string and container.
+ *
+ * The document cannot be modified, but a node can be converted to a
+ * Value with Node::toValue().
+ *
+ * Usage example:
+ * \code
+ * Json::Document doc;
+ * doc.parse(request.in());
+ *
+ * const Json::Node& items = doc.root().get("items");
+ * for (std::size_t i = 0; i < items.size(); ++i)
+ *   total += items[i].get("price").toNumber();
+ * \endcode
+ *
+ * \ingroup json
+ */
+class WT_API Document
+{
+public:
+  /*! \brief Creates an empty document.
+   *
+   * The root() of an empty document is null.
+   */
+  Document();
+
+  Document(Document&& other) noexcept;
+  Document& operator=(Document&& other) noexcept;
+
+  Document(const Document& other) = delete;
+  Document& operator=(const Document& other) = delete;
+
+  ~Document();
+
+  /*! \brief Parses a JSON text.
+   *
+   * Unlike the parse() functions into a Value, the root may be any
+   * JSON value. The previous contents are discarded.
+   *
+   * If \p validateUTF8 is \c true, invalid UTF-8 sequences in strings
+   * are replaced by '?'.
+   *
+   * \throws ParseError when the input is not valid JSON.
+   */
+  void parse(const char *input, std::size_t length, bool validateUTF8 = true);
+
+  /*! \brief Parses a JSON text.
+   *
+   * \throws ParseError when the input is not valid JSON.
+   */
+  void parse(const std::string& input, bool validateUTF8 = true);
+
+  /*! \brief Parses a JSON text.
+   *
+   * Returns \c true if the parse was successful, or reports an error
+   * in \p error otherwise.
+   */
+  bool parse(const std::string& input, ParseError& error,
+             bool validateUTF8 = true);
+
+  /*! \brief Parses a JSON text from a stream.
+   *
+   * \throws ParseError when the input is not valid JSON.
+   */
+  void parse(std::istream& input, bool validateUTF8 = true);
+
+  /*! \brief Returns the root value.
+   */
+  const Node& root() const { return root_; }
+
+  /*! \brief Clears the document.
+   *
+   * This releases all memory, except for the first block of the
+   * arena which is reused by the next parse().
+   */
+  void clear();
+
+  /*! \brief Returns the memory allocated by the arena.
+   */
+  std::size_t allocatedSize() const;
+
+private:
+  struct Block {
+    std::unique_ptr<char[]> data;
+    std::size_t size;
+  };
+
+  class Builder;
+
+  std::vector<Block> blocks_;
+  std::size_t used_;
+  Node root_;
+
+  void *allocate(std::size_t size);
+  const char *copyString(const char *data, std::size_t length);
+  Node stringNode(const char *data, std::size_t length);
+};
+
+  }
+}
+
+#endif // WT_JSON_DOCUMENT_H_
@@ -7,6 +7,7 @@
 #ifndef WT_JSON_PARSER_H_
 #define WT_JSON_PARSER_H_
 
+#include <cstddef>
 #include <string>
 #include <Wt/WException.h>
 
@@ -130,6 +131,106 @@ WT_API extern void parse(const std::string& input, Array& result,
 WT_API extern bool parse(const std::string& input, Array& result,
                          ParseError& error, bool validateUTF8 = true);
 
+#ifndef WT_TARGET_JAVA
+/*! \class SaxHandler Wt/Json/Parser.h Wt/Json/Parser.h
+ *  \brief Receives the contents of a JSON text, while it is parsed.
+ *
+ * This is the interface for the streaming parse() functions, which
+ * do not build a Value, but report every token of the input to the
+ * handler as it is parsed.
+ *
+ * Strings (and object member names) are passed as a pointer and a
+ * length, in UTF-8, without a terminating null character, and are
+ * only valid during the call. When possible, they point directly into
+ * the input.
+ *
+ * Each method returns whether parsing should continue: returning \c
+ * false stops parsing.
+ *
+ * \sa Document
+ *
+ * \ingroup json
+ */
+class WT_API SaxHandler
+{
+public:
+  /*! \brief Destructor.
+   */
+  virtual ~SaxHandler();
+
+  /*! \brief Start of an object.
+   *
+   * This is followed by a key() and a value for every member, and
+   * endObject().
+   */
+  virtual bool startObject() = 0;
+
+  /*! \brief Name of an object member.
+   */
+  virtual bool key(const char *data, std::size_t length) = 0;
+
+  /*! \brief End of an object.
+   */
+  virtual bool endObject() = 0;
+
+  /*! \brief Start of an array.
+   *
+   * This is followed by every value of the array, and endArray().
+   */
+  virtual bool startArray() = 0;
+
+  /*! \brief End of an array.
+   */
+  virtual bool endArray() = 0;
+
+  /*! \brief A string value.
+   */
+  virtual bool string(const char *data, std::size_t length) = 0;
+
+  /*! \brief A number value.
+   */
+  virtual bool number(double value) = 0;
+
+  /*! \brief A boolean value.
+   */
+  virtual bool boolean(bool value) = 0;
+
+  /*! \brief A null value.
+   */
+  virtual bool null() = 0;
+};
+
+/*! \brief Streaming parse function
+ *
+ * This function parses the input (which represents a UTF-8
+ * JSON-encoded value), and reports its contents to the \p handler,
+ * without building a Value. Unlike the other parse functions, the
+ * input may also be a single string, number, boolean or null value.
+ *
+ * If validateUTF8 is true, invalid UTF-8 in strings is replaced by
+ * '?' characters, as with the other parse functions, but without
+ * copying the input first.
+ *
+ * Returns \c false if parsing was stopped by the handler, and \c true
+ * if the complete input was parsed.
+ *
+ * \throws ParseError when the input is not a correct JSON structure.
+ *
+ * \ingroup json
+ */
+WT_API extern bool parse(const char *input, std::size_t length,
+                         SaxHandler& handler, bool validateUTF8 = true);
+
+/*! \brief Streaming parse function
+ *
+ * \sa parse(const char *, std::size_t, SaxHandler&, bool)
+ *
+ * \ingroup json
+ */
+WT_API extern bool parse(const std::string& input, SaxHandler& handler,
+                         bool validateUTF8 = true);
+#endif // WT_TARGET_JAVA
+
 #ifdef WT_TARGET_JAVA
     class Parser {
       Object parse(const std::string& input, bool validateUTF8 = true);
@@ -8,18 +8,20 @@
 #define WT_JSON_SERIALIZER_H
 
 #include <Wt/WDllDefs.h>
+#include <Wt/WString.h>
+#include <iosfwd>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace Wt {
 class EscapeOStream;
+class WStringStream;
   namespace Json {
 
 class Object;
 class Array;
-
-#ifdef WT_TARGET_JAVA
 class Value;
-#endif // WT_TARGET_JAVA
 
 /*! \brief Serialization function for an Object.
  *
@@ -49,6 +51,197 @@ void serialize(const Object& obj, int indentation, EscapeOStream& result);
 std::string WT_API serialize(const Array& arr, int indentation = 1);
 void serialize(const Array& arr, int indentation, EscapeOStream& result);
 
+#ifndef WT_TARGET_JAVA
+/*! \brief Serialization function for an Object, to a stream.
+ *
+ * Like serialize(const Object&, int), but writes to \p out while
+ * serializing, using only a small buffer, instead of building the
+ * result in memory.
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const Object& obj, std::ostream& out,
+                      int indentation = 1);
+
+/*! \brief Serialization function for an Array, to a stream.
+ *
+ * Like serialize(const Array&, int), but writes to \p out while
+ * serializing, using only a small buffer, instead of building the
+ * result in memory.
+ *
+ * \ingroup json
+ */
+WT_API void serialize(const Array& arr, std::ostream& out,
+                      int indentation = 1);
+
+/*! \class Writer Wt/Json/Serializer.h Wt/Json/Serializer.h
+ *  \brief A streaming JSON writer.
+ *
+ * The writer serializes JSON incrementally, as the values are passed
+ * to it, to an std::ostream. Only a small buffer is kept, so that
+ * large documents (e.g. the result of a query) do not need to be
+ * built in memory. The output is compact: no whitespace is added.
+ *
+ * \code
+ * Json::Writer writer(response.out());
+ * writer.startArray();
+ * for (const auto& item : items)
+ *   writer.startObject()
+ *     .key("name").value(item.name)
+ *     .key("price").value(item.price)
+ *     .endObject();
+ * writer.endArray();
+ * \endcode
+ *
+ * Objects that are serialized by another serializer, such as
+ * Dbo::JsonSerializer, can be written using valueStream():
+ *
+ * \code
+ * for (const dbo::ptr<Post>& post : posts)
+ *   dbo::jsonSerialize(post, writer.valueStream());
+ * \endcode
+ *
+ * Note that an Http::Response keeps all output in memory until
+ * WResource::handleRequest() returns. To send a large document in
+ * parts, keep the writer in the data() of a ResponseContinuation,
+ * write a part in every call to handleRequest(), and pass the new
+ * response with setOutput().
+ *
+ * \throws WException when the sequence of calls does not represent
+ * a valid JSON value.
+ *
+ * \ingroup json
+ */
+class WT_API Writer
+{
+public:
+  /*! \brief Creates a writer.
+   */
+  explicit Writer(std::ostream& out);
+
+  /*! \brief Destructor.
+   *
+   * Flushes the buffered output.
+   */
+  ~Writer();
+
+  Writer(const Writer&) = delete;
+  Writer& operator=(const Writer&) = delete;
+
+  /*! \brief Changes the output stream.
+   *
+   * The output that was buffered is flushed to the previous stream.
+   */
+  void setOutput(std::ostream& out);
+
+  /*! \brief Starts an object.
+   */
+  Writer& startObject();
+
+  /*! \brief Ends an object.
+   */
+  Writer& endObject();
+
+  /*! \brief Starts an array.
+   */
+  Writer& startArray();
+
+  /*! \brief Ends an array.
+   */
+  Writer& endArray();
+
+  /*! \brief Writes the name of an object member.
+   *
+   * This must be followed by its value.
+   */
+  Writer& key(const std::string& name);
+
+  /*! \brief Writes a value.
+   */
+  Writer& value(const Value& value);
+
+  /*! \brief Writes an object.
+   */
+  Writer& value(const Object& value);
+
+  /*! \brief Writes an array.
+   */
+  Writer& value(const Array& value);
+
+  /*! \brief Writes a string (UTF-8).
+   */
+  Writer& value(const std::string& value);
+
+  /*! \brief Writes a string (UTF-8).
+   */
+  Writer& value(const char *value);
+
+  /*! \brief Writes a string.
+   */
+  Writer& value(const WString& value);
+
+  /*! \brief Writes a boolean.
+   */
+  Writer& value(bool value);
+
+  /*! \brief Writes a number.
+   */
+  Writer& value(int value);
+
+  /*! \brief Writes a number.
+   */
+  Writer& value(long long value);
+
+  /*! \brief Writes a number.
+   *
+   * NaN and infinite values are written as null.
+   */
+  Writer& value(double value);
+
+  /*! \brief Writes null.
+   */
+  Writer& null();
+
+  /*! \brief Writes a value that is already serialized.
+   *
+   * The \p json is written as is, and must be a valid JSON value.
+   */
+  Writer& rawValue(const std::string& json);
+
+  /*! \brief Returns the stream to write a serialized value to.
+   *
+   * This flushes the buffered output and returns the output stream, on
+   * which the caller must write exactly one JSON value (and flush any
+   * buffer of its own) before using the writer again.
+   */
+  std::ostream& valueStream();
+
+  /*! \brief Flushes the buffered output to the output stream.
+   *
+   * This does not flush the std::ostream itself.
+   */
+  void flush();
+
+  /*! \brief Returns the number of objects and arrays that are open.
+   */
+  int depth() const { return static_cast<int>(stack_.size()); }
+
+private:
+  std::ostream *out_;
+  std::unique_ptr<WStringStream> stream_;
+  std::unique_ptr<EscapeOStream> escapeOut_, stringLiteral_;
+  std::vector<char> stack_;
+  bool first_, afterKey_, done_;
+
+  void open(std::ostream& out);
+  void close();
+  void beforeValue();
+  void afterValue();
+  void writeString(const std::string& s);
+  void writeValue(const Value& value);
+};
+#endif // WT_TARGET_JAVA
+
 #ifdef WT_TARGET_JAVA
 std::string serialize(const Value& arr, int indentation = 1);
 #endif // WT_TARGET_JAVA
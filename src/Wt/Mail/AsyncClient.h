@@ -0,0 +1,207 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_MAIL_ASYNC_CLIENT_H_
+#define WT_MAIL_ASYNC_CLIENT_H_
+
+#include <Wt/WDllDefs.h>
+#include <Wt/AsioWrapper/io_service.hpp>
+#include <Wt/Mail/Client.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace Wt {
+  namespace Mail {
+
+class Message;
+
+/*! \class AsyncClient Wt/Mail/AsyncClient.h Wt/Mail/AsyncClient.h
+ *  \brief An asynchronous SMTP mail client.
+ *
+ * Unlike Client, this client does not block the calling thread:
+ * send() queues the message and returns immediately. The messages
+ * are sent using asynchronous I/O, by default within the I/O service
+ * of the %Wt server (WServer::ioService()), over a small pool of
+ * persistent connections to the SMTP host.
+ *
+ * \code
+ * auto client = std::make_unique<Mail::AsyncClient>();
+ * client->setMaximumConnections(4);
+ *
+ * Mail::Message message;
+ * ...
+ * client->send(message, [](bool sent) {
+ *   ...
+ * });
+ * \endcode
+ *
+ * A connection is reused for subsequent messages, and is closed after
+ * it has been idle for a while (see setIdleTimeout()). When the server
+ * supports the PIPELINING extension (RFC 2920), the envelope commands
+ * of a message are sent at once, rather than waiting for the reply to
+ * each command.
+ *
+ * A message that could not be sent because of a connection problem or
+ * a transient error (a 4xx reply) is retried after a delay (see
+ * setMaximumRetries() and setRetryDelay()). A permanent error (a 5xx
+ * reply) is not retried.
+ *
+ * The queue of messages waiting to be sent is bounded (see
+ * setMaximumQueueSize()): when it is full, send() refuses the message.
+ *
+ * The client is configured in the same way as Client, using the same
+ * configuration properties, and in addition the "smtp-host" and
+ * "smtp-port" properties are used as defaults for setServer(). The
+ * configuration should be done before the first message is sent.
+ *
+ * The client is thread-safe: messages may be sent from different
+ * sessions concurrently, which makes it suitable to be shared, for
+ * example by an Auth::AuthService (see
+ * Auth::AuthService::setMailClient()).
+ *
+ * \ingroup mail
+ */
+class WT_API AsyncClient
+{
+public:
+  /*! \brief Typedef for a function that is notified of the result.
+   *
+   * The argument indicates whether the message was accepted by the
+   * SMTP server. The function is called from within the I/O service,
+   * outside of any session: use WServer::post() to update a session.
+   */
+  typedef std::function<void (bool sent)> SendCallback;
+
+  /*! \brief Constructor.
+   *
+   * The client uses the I/O service of the server
+   * (WServer::instance()), which must exist.
+   *
+   * The \p selfHost is used as with Client::Client().
+   */
+  explicit AsyncClient(const std::string& selfHost = std::string());
+
+  /*! \brief Constructor.
+   *
+   * The client uses the given I/O service, and is useful to use the
+   * client outside of the context of a %Wt server.
+   */
+  AsyncClient(AsioWrapper::asio::io_service& ioService,
+              const std::string& selfHost = std::string());
+
+  AsyncClient(const AsyncClient&) = delete;
+  AsyncClient& operator=(const AsyncClient&) = delete;
+
+  /*! \brief Destructor.
+   *
+   * Messages that are being sent are completed, and the connections
+   * are closed after that. Messages that are still waiting in the
+   * queue are discarded, without calling their callback.
+   */
+  ~AsyncClient();
+
+  /*! \brief Enables authentication.
+   *
+   * \sa Client::enableAuthentication()
+   */
+  void enableAuthentication(const std::string &username,
+                            const std::string &password,
+                            AuthenticationMethod method = AuthenticationMethod::Plain);
+
+  /*! \brief Sets whether SSL certificate verification is enabled.
+   *
+   * Defaults to true.
+   */
+  void setSslCertificateVerificationEnabled(bool enabled);
+
+  /*! \brief Sets the transport encryption method.
+   *
+   * \sa Client::setTransportEncryption()
+   */
+  void setTransportEncryption(TransportEncryption method);
+
+  /*! \brief Sets the SMTP server.
+   *
+   * The default is defined by the "smtp-host" and "smtp-port"
+   * properties, or "localhost" and 25 if these are not set.
+   */
+  void setServer(const std::string& smtpHost, int smtpPort = 25);
+
+  /*! \brief Sets the maximum number of connections.
+   *
+   * The default is 2.
+   */
+  void setMaximumConnections(int connections);
+
+  /*! \brief Sets the maximum number of messages waiting to be sent.
+   *
+   * The default is 1000.
+   */
+  void setMaximumQueueSize(int size);
+
+  /*! \brief Sets the number of times a message is retried.
+   *
+   * The default is 3.
+   */
+  void setMaximumRetries(int retries);
+
+  /*! \brief Sets the delay before a message is retried.
+   *
+   * The default is 10 seconds.
+   */
+  void setRetryDelay(std::chrono::steady_clock::duration delay);
+
+  /*! \brief Sets an I/O timeout.
+   *
+   * The default is 30 seconds.
+   */
+  void setTimeout(std::chrono::steady_clock::duration timeout);
+
+  /*! \brief Sets the time after which an idle connection is closed.
+   *
+   * The default is 30 seconds.
+   */
+  void setIdleTimeout(std::chrono::steady_clock::duration timeout);
+
+  /*! \brief Sends a message.
+   *
+   * The message is queued, and sent asynchronously. The \p callback,
+   * if not empty, is called with the result.
+   *
+   * Returns \c false, without calling the \p callback, if the queue
+   * is full.
+   */
+  bool send(const Message& message,
+            const SendCallback& callback = SendCallback());
+
+  /*! \brief Returns the number of messages waiting to be sent.
+   */
+  int queueSize() const;
+
+  /*! \brief Returns the number of messages sent so far.
+   */
+  long long sentCount() const;
+
+  /*! \brief Returns the number of messages that could not be sent.
+   *
+   * This includes the messages that were refused by send().
+   */
+  long long failedCount() const;
+
+private:
+  class Connection;
+  class Impl;
+
+  std::shared_ptr<Impl> impl_;
+};
+
+  }
+}
+
+#endif // WT_MAIL_ASYNC_CLIENT_H_
@@ -68,10 +68,10 @@ enum class TransportEncryption {
  * Only the bare essentials of the SMTP protocol are current implemented,
  * although the Message itself supports proper unicode handling.
  *
- * \note Currently the client sends an email synchronously, and thus a slow
- *       connection to the SMTP server may block the current thread. We plan
- *       to change this in the future. It is thus beneficial to connect to a
- *       local SMTP daemon to minimize this deficiency.
+ * \note The client sends an email synchronously, and thus a slow
+ *       connection to the SMTP server may block the current thread. Use
+ *       AsyncClient to send emails without blocking, or connect to a local
+ *       SMTP daemon to minimize this deficiency.
  *
  * \ingroup mail
  */
@@ -186,6 +186,8 @@ public:
 
 private:
   Client(const Client&);
+  friend class AsyncClient;
+
   class BaseImpl;
   template<bool ssl>
   class Impl;
@@ -15,7 +15,7 @@
 #include "web/DomElement.h"
 #include "LayoutBox.h"
 #include "thirdparty/rapidxml/rapidxml.hpp"
-#include "Wt/Render/Specificity.h"
+#include "Wt/Render/CssData.h"
 
 namespace Wt {
   namespace Render {
@@ -176,6 +176,7 @@ private:
   double currentWidth_;
   double contentsHeight_;
   mutable std::map<std::string, PropertyValue> css_;
+  mutable bool cssMatched_;
   mutable WFont font_;
   StyleSheet* styleSheet_;
   mutable std::set<Property> noPropertyCache_;
@@ -188,11 +189,10 @@ private:
 
   int attributeValue(const char *attribute, int defaultValue) const;
 
-  void updateAggregateProperty(const std::string& property,
-                               const std::string& aggregate,
-                               const Specificity& spec,
-                               const std::string& value) const;
-  void fillinStyle(const std::string& style,
+  void updateProperty(const std::string& property,
+                      const Specificity& spec,
+                      const std::string& value) const;
+  void fillinStyle(const DeclarationBlock::Declarations& declarations,
                    const Specificity &specificity) const;
   bool isPositionedAbsolutely() const;
   std::string inheritedCssProperty(Property property) const;
@@ -329,8 +329,6 @@ private:
   static void unsupportedCssValue(Property property,
                                   const std::string& value);
 
-  static bool isAggregate(const std::string& cssProperty);
-
   static double maxBorderWidth(Block *b1, Side s1,
                                Block *b2, Side s2,
                                Block *b3, Side s3,
@@ -6,6 +6,10 @@
 #include <Wt/WWebWidget.h>
 #include "Wt/Render/Specificity.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 
 namespace Wt{
 namespace Render{
@@ -42,9 +46,16 @@ public:
 class DeclarationBlock
 {
 public:
+  typedef std::vector<std::pair<std::string, std::string> > Declarations;
+
   virtual ~DeclarationBlock(){}
   virtual Term value(const std::string& property) const = 0;
   virtual const std::string& declarationString() const = 0;
+
+  // The declarations, with aggregate properties (e.g. margin) expanded
+  virtual const Declarations& declarations() const = 0;
+
+  static Declarations parseDeclarations(const std::string& declarationString);
 };
 
 class Ruleset
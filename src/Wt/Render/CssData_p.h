@@ -79,9 +79,12 @@ public:
   virtual Term value(const std::string& property) const override;
   virtual const std::string& declarationString() const override
     { return declarationString_; }
+  virtual const Declarations& declarations() const override
+    { return declarations_; }
 
   std::map<std::string, Term > properties_;
   std::string declarationString_;
+  Declarations declarations_;
 };
 
 class RulesetImpl : public Ruleset
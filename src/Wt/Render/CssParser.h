@@ -8,6 +8,7 @@
 #define RENDER_CSSPARSER_H_
 
 #include <iostream>
+#include <memory>
 
 #include <Wt/WDllDefs.h>
 #include <Wt/WString.h>
@@ -23,6 +24,12 @@ public:
 
   std::unique_ptr<StyleSheet> parse(const WString& styleSheetContents);
   std::unique_ptr<StyleSheet> parseFile(const WString& filename);
+
+  /*
+   * Like parse(), but returns the style sheet from a process-wide
+   * cache if the same contents were parsed before.
+   */
+  std::shared_ptr<const StyleSheet> parseCached(const WString& styleSheetContents);
   std::string getLastError() const;
 
 private:
@@ -0,0 +1,112 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef RENDER_WFONT_METRICS_CACHE_H_
+#define RENDER_WFONT_METRICS_CACHE_H_
+
+#include <Wt/WFontMetrics.h>
+#include <Wt/WPaintDevice.h>
+
+#include <string>
+#include <unordered_map>
+
+#ifdef WT_THREADED
+#include <mutex>
+#endif // WT_THREADED
+
+namespace Wt {
+  namespace Render {
+
+/*! \class WFontMetricsCache Wt/Render/WFontMetricsCache.h Wt/Render/WFontMetricsCache.h
+ *  \brief A cache of font metrics and text measurements.
+ *
+ * Laying out XHTML with WTextRenderer measures every line and word
+ * of text, and does so repeatedly (e.g. for table cells, and again
+ * for painting). Documents that are rendered from the same template
+ * measure the same texts over and over.
+ *
+ * When a renderer is configured with a cache (see
+ * WTextRenderer::setFontMetricsCache()), font metrics and text
+ * measurements are looked up in the cache first, and only measured
+ * by the paint device when missing. A cache may be shared by many
+ * renderers, also from different threads: it is thread-safe.
+ *
+ * Measurements depend on the fonts that are available to the paint
+ * device: a cache should only be shared between renderers that use
+ * the same type of paint device, with the same font collections
+ * (see e.g. WPdfRenderer::addFontCollection()).
+ *
+ * \ingroup render
+ */
+class WT_API WFontMetricsCache
+{
+public:
+  /*! \brief Constructor.
+   *
+   * Creates a cache that holds at most \p maximumSize measurements.
+   */
+  explicit WFontMetricsCache(int maximumSize = 100000);
+
+  WFontMetricsCache(const WFontMetricsCache&) = delete;
+  WFontMetricsCache& operator=(const WFontMetricsCache&) = delete;
+
+  /*! \brief Returns the maximum number of measurements.
+   */
+  int maximumSize() const { return maximumSize_; }
+
+  /*! \brief Returns the metrics of a font.
+   *
+   * On a miss, the metrics are computed by the \p device, on which
+   * the \p font must be the current font.
+   *
+   * \sa WPaintDevice::fontMetrics()
+   */
+  WFontMetrics fontMetrics(WPaintDevice *device, const WFont& font);
+
+  /*! \brief Measures a text.
+   *
+   * On a miss, the text is measured by the \p device, on which the \p
+   * font must be the current font.
+   *
+   * \sa WPaintDevice::measureText()
+   */
+  WTextItem measureText(WPaintDevice *device, const WFont& font,
+                        const WString& text, double maxWidth = -1,
+                        bool wordWrap = false);
+
+  /*! \brief Removes all measurements.
+   */
+  void clear();
+
+  /*! \brief Returns the number of cached measurements.
+   */
+  int size() const;
+
+  /*! \brief Returns the number of successful lookups so far.
+   */
+  long long hits() const;
+
+  /*! \brief Returns the number of unsuccessful lookups so far.
+   */
+  long long misses() const;
+
+private:
+  int maximumSize_;
+  std::unordered_map<std::string, WFontMetrics> fontMetrics_;
+  std::unordered_map<std::string, WTextItem> textItems_;
+  long long hits_, misses_;
+
+#ifdef WT_THREADED
+  mutable std::mutex mutex_;
+#endif // WT_THREADED
+
+  void makeRoom();
+};
+
+  }
+}
+
+#endif // RENDER_WFONT_METRICS_CACHE_H_
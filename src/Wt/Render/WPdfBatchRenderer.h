@@ -0,0 +1,292 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef RENDER_WPDF_BATCH_RENDERER_H_
+#define RENDER_WPDF_BATCH_RENDERER_H_
+
+#include <Wt/WGlobal.h>
+#include <Wt/WString.h>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <hpdf.h>
+
+#ifdef WT_THREADED
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif // WT_THREADED
+
+namespace Wt {
+  namespace Render {
+
+class WFontMetricsCache;
+
+/*! \class WPdfBatchRenderer Wt/Render/WPdfBatchRenderer.h Wt/Render/WPdfBatchRenderer.h
+ *  \brief Renders PDF documents from XHTML templates, in a pool of threads.
+ *
+ * This class renders many similar documents (such as invoices or
+ * reports) using WPdfRenderer. A document is rendered from a
+ * template, which is XHTML with <tt>${name}</tt> placeholders, and
+ * the data to substitute for the placeholders:
+ *
+ * \code
+ * auto renderer = std::make_shared<Render::WPdfBatchRenderer>(4);
+ * renderer->addTemplate("invoice", WString::tr("invoice-template"));
+ * renderer->setStyleSheetText(invoiceCss);
+ * renderer->setMargin(2);
+ * renderer->addFontCollection("/usr/share/fonts/truetype");
+ *
+ * Render::WPdfBatchRenderer::Data data;
+ * data.bind("customer", customer.name);
+ * data.bind("lines", linesXhtml, TextFormat::XHTML);
+ *
+ * renderer->renderToFile("invoice", data, "/var/invoices/1234.pdf",
+ *                        [](bool ok) { ... });
+ * \endcode
+ *
+ * Documents are queued, and rendered in the threads of the renderer.
+ * The work that does not depend on the data is shared between the
+ * documents:
+ *  - templates are parsed once, when added;
+ *  - the style sheet is parsed once;
+ *  - font metrics and text measurements are cached (see
+ *    fontMetricsCache());
+ *  - each thread reuses its PDF document (\c HPDF_Doc) and the true
+ *    type fonts that were loaded in it.
+ *
+ * A rendered document is either written to a file (renderToFile()),
+ * or passed in memory to a callback (render()). WPdfBatchResource
+ * serves rendered documents as a resource.
+ *
+ * The queue of documents waiting to be rendered is bounded (see the
+ * constructor): when it is full, a document is refused.
+ *
+ * The configuration (page size, margins, style sheet, fonts) should
+ * be done before the first document is queued. Templates may be
+ * added at any time.
+ *
+ * \if cpp
+ * In a build without thread support, documents are rendered
+ * immediately by render() and renderToFile().
+ * \endif
+ *
+ * \ingroup render
+ */
+class WT_API WPdfBatchRenderer
+{
+public:
+  /*! \brief The data for a document.
+   */
+  class WT_API Data
+  {
+  public:
+    /*! \brief Binds a value to a placeholder.
+     *
+     * With TextFormat::Plain, the \p value is escaped, otherwise the
+     * value is inserted as XHTML, which must be well-formed.
+     */
+    void bind(const std::string& name, const WString& value,
+              TextFormat textFormat = TextFormat::Plain);
+
+    /*! \brief Returns whether a placeholder is bound.
+     */
+    bool isBound(const std::string& name) const;
+
+  private:
+    std::map<std::string, std::string> values_;
+
+    friend class WPdfBatchRenderer;
+  };
+
+  /*! \brief Typedef for a function that receives a rendered document.
+   *
+   * The argument is the PDF document, which is empty when rendering
+   * failed. The function is called from within a thread of the
+   * renderer: use WServer::post() to update a session.
+   */
+  typedef std::function<void (const std::string& document)> DocumentCallback;
+
+  /*! \brief Typedef for a function that is notified of a rendered file.
+   *
+   * The argument indicates whether the file was written. The function
+   * is called from within a thread of the renderer.
+   */
+  typedef std::function<void (bool ok)> FileCallback;
+
+  /*! \brief Constructor.
+   *
+   * Creates a renderer with \p threads threads, and a queue for at
+   * most \p maximumQueueSize waiting documents.
+   */
+  explicit WPdfBatchRenderer(int threads = 2, int maximumQueueSize = 1000);
+
+  WPdfBatchRenderer(const WPdfBatchRenderer&) = delete;
+  WPdfBatchRenderer& operator=(const WPdfBatchRenderer&) = delete;
+
+  /*! \brief Destructor.
+   *
+   * Waits for the documents that are being rendered. Documents that
+   * are still waiting in the queue are discarded, without calling
+   * their callback.
+   */
+  ~WPdfBatchRenderer();
+
+  /*! \brief Adds a template.
+   *
+   * The \p xhtml is parsed for <tt>${name}</tt> placeholders, and
+   * stored under the given \p name, replacing any previous template
+   * with that name.
+   */
+  void addTemplate(const std::string& name, const WString& xhtml);
+
+  /*! \brief Returns whether a template exists.
+   */
+  bool hasTemplate(const std::string& name) const;
+
+  /*! \brief Sets the style sheet.
+   *
+   * Returns \c false if the style sheet could not be parsed.
+   *
+   * \sa WTextRenderer::setStyleSheetText()
+   */
+  bool setStyleSheetText(const WString& contents);
+
+  /*! \brief Sets the page size.
+   *
+   * The \p width and \p height are in points (1/72 inch). The default
+   * is A4 (595.276 x 841.89).
+   */
+  void setPageSize(double width, double height);
+
+  /*! \brief Sets the page margins.
+   *
+   * \sa WPdfRenderer::setMargin()
+   */
+  void setMargin(double cm, WFlags<Side> sides = AllSides);
+
+  /*! \brief Sets the resolution.
+   *
+   * \sa WPdfRenderer::setDpi()
+   */
+  void setDpi(int dpi);
+
+  /*! \brief Sets the font scale.
+   *
+   * \sa WTextRenderer::setFontScale()
+   */
+  void setFontScale(double scale);
+
+  /*! \brief Adds a font collection.
+   *
+   * \sa WPdfRenderer::addFontCollection()
+   */
+  void addFontCollection(const std::string& directory, bool recursive = true);
+
+  /*! \brief Returns the font metrics cache.
+   *
+   * The cache is shared by all documents that are rendered.
+   */
+  std::shared_ptr<WFontMetricsCache> fontMetricsCache() const {
+    return fontMetricsCache_;
+  }
+
+  /*! \brief Renders a document in memory.
+   *
+   * The document is rendered from the template \p templateName and
+   * the \p data, and passed to the \p callback.
+   *
+   * Returns \c false, without calling the \p callback, if the queue
+   * is full or the template does not exist.
+   */
+  bool render(const std::string& templateName, const Data& data,
+              const DocumentCallback& callback);
+
+  /*! \brief Renders a document to a file.
+   *
+   * The document is rendered from the template \p templateName and
+   * the \p data, and written to \p fileName. The \p callback, if not
+   * empty, is called with the result.
+   *
+   * Returns \c false, without calling the \p callback, if the queue
+   * is full or the template does not exist.
+   */
+  bool renderToFile(const std::string& templateName, const Data& data,
+                    const std::string& fileName,
+                    const FileCallback& callback = FileCallback());
+
+  /*! \brief Returns the number of threads.
+   */
+  int threadCount() const { return threadCount_; }
+
+  /*! \brief Returns the maximum number of waiting documents.
+   */
+  int maximumQueueSize() const { return maximumQueueSize_; }
+
+  /*! \brief Returns the number of waiting documents.
+   */
+  int queueSize() const;
+
+  /*! \brief Returns the number of documents being rendered.
+   */
+  int activeCount() const;
+
+  /*! \brief Returns the number of documents rendered so far.
+   */
+  long long renderedCount() const;
+
+  /*! \brief Returns the number of documents that could not be rendered.
+   *
+   * This includes the documents that were refused.
+   */
+  long long failedCount() const;
+
+private:
+  struct Template;
+  struct Job;
+
+  struct FontCollection {
+    std::string directory;
+    bool recursive;
+  };
+
+  int threadCount_, maximumQueueSize_;
+  std::map<std::string, std::shared_ptr<const Template> > templates_;
+  WString styleSheetText_;
+  double pageWidth_, pageHeight_;
+  double margin_[4];
+  int dpi_;
+  double fontScale_;
+  std::vector<FontCollection> fontCollections_;
+  std::shared_ptr<WFontMetricsCache> fontMetricsCache_;
+
+  std::deque<std::shared_ptr<Job> > queue_;
+  int active_;
+  long long rendered_, failed_;
+  bool stopping_;
+
+#ifdef WT_THREADED
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<std::thread> threads_;
+#endif // WT_THREADED
+
+  bool post(const std::string& templateName, const std::shared_ptr<Job>& job);
+  void run();
+  bool execute(const Job& job, HPDF_Doc& pdf);
+  void renderDocument(HPDF_Doc& pdf, const Job& job, std::string& document);
+  std::string xhtml(const Job& job) const;
+};
+
+  }
+}
+
+#endif // RENDER_WPDF_BATCH_RENDERER_H_
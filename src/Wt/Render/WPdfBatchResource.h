@@ -0,0 +1,99 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef RENDER_WPDF_BATCH_RESOURCE_H_
+#define RENDER_WPDF_BATCH_RESOURCE_H_
+
+#include <Wt/WResource.h>
+#include <Wt/Render/WPdfBatchRenderer.h>
+
+#include <memory>
+#include <string>
+
+namespace Wt {
+  namespace Render {
+
+/*! \class WPdfBatchResource Wt/Render/WPdfBatchResource.h Wt/Render/WPdfBatchResource.h
+ *  \brief A resource that serves documents rendered by a WPdfBatchRenderer.
+ *
+ * The document is rendered from a template, using the data returned
+ * by documentData() for the request. The request is suspended (see
+ * Http::ResponseContinuation) while the document is rendered, so that
+ * no server thread is blocked waiting for the renderer.
+ *
+ * \code
+ * class InvoiceResource : public Render::WPdfBatchResource
+ * {
+ * public:
+ *   InvoiceResource(std::shared_ptr<Render::WPdfBatchRenderer> renderer)
+ *     : WPdfBatchResource(renderer, "invoice")
+ *   {
+ *     suggestFileName("invoice.pdf");
+ *   }
+ *
+ * protected:
+ *   Render::WPdfBatchRenderer::Data
+ *   documentData(const Http::Request& request) override
+ *   {
+ *     Render::WPdfBatchRenderer::Data data;
+ *     data.bind("customer", ...);
+ *     return data;
+ *   }
+ * };
+ * \endcode
+ *
+ * If the renderer refuses the document, because its queue is full,
+ * the response has status 503 (Service Unavailable). If rendering
+ * fails, the response has status 500.
+ *
+ * \ingroup render
+ */
+class WT_API WPdfBatchResource : public WResource
+{
+public:
+  /*! \brief Constructor.
+   *
+   * The resource renders documents from the template \p templateName
+   * of the \p renderer.
+   */
+  WPdfBatchResource(const std::shared_ptr<WPdfBatchRenderer>& renderer,
+                    const std::string& templateName);
+
+  /*! \brief Destructor.
+   */
+  ~WPdfBatchResource();
+
+  /*! \brief Returns the renderer.
+   */
+  std::shared_ptr<WPdfBatchRenderer> renderer() const { return renderer_; }
+
+  /*! \brief Returns the template name.
+   */
+  const std::string& templateName() const { return templateName_; }
+
+  virtual void handleRequest(const Http::Request& request,
+                             Http::Response& response) override;
+
+protected:
+  /*! \brief Returns the data for the document of a request.
+   *
+   * This is called from within handleRequest(), and thus possibly
+   * outside of the session lock (see setTakesUpdateLock()).
+   */
+  virtual WPdfBatchRenderer::Data
+    documentData(const Http::Request& request) = 0;
+
+private:
+  struct Result;
+
+  std::shared_ptr<WPdfBatchRenderer> renderer_;
+  std::string templateName_;
+};
+
+  }
+}
+
+#endif // RENDER_WPDF_BATCH_RESOURCE_H_
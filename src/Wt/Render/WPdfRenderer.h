@@ -64,6 +64,13 @@ namespace Wt {
  * (Unicode). See addFontCollection() for more information on how
  * fonts are located.
  *
+ * When rendering many documents, share a WFontMetricsCache between
+ * the renderers (see setFontMetricsCache()), to avoid measuring the
+ * same texts again for every document. Renderers for different
+ * documents may be used concurrently from different threads, but a
+ * single document (\c HPDF_Doc) can only be rendered by one thread
+ * at a time. WPdfBatchRenderer renders many documents in this way.
+ *
  * \ingroup render
  */
 class WT_API WPdfRenderer : public WTextRenderer
@@ -130,7 +137,8 @@ public:
    * \endcode
    * \endif
    *
-   * \sa WPdfImage::addFontCollection()
+   * \sa WPdfImage::addFontCollection(),
+   *     WPdfImage::clearFontCollectionCache()
    */
   void addFontCollection(const std::string& directory, bool recursive=true);
 
@@ -7,6 +7,8 @@
 #ifndef RENDER_WTEXT_RENDERER_H_
 #define RENDER_WTEXT_RENDERER_H_
 
+#include <Wt/WFontMetrics.h>
+#include <Wt/WPaintDevice.h>
 #include <Wt/WString.h>
 #include <Wt/WWebWidget.h>
 
@@ -17,6 +19,7 @@ namespace Wt {
 
 class StyleSheet;
 class Block;
+class WFontMetricsCache;
 struct LayoutBox;
 
 /*! \defgroup render XHTML Rendering (Wt::Render)
@@ -263,6 +266,26 @@ public:
    */
   double fontScale() const { return fontScale_; }
 
+  /*! \brief Sets a cache for font metrics and text measurements.
+   *
+   * By default, the renderer has no cache, and every font metric
+   * and text measurement is computed by the paint device. A cache
+   * may be shared between renderers (see WFontMetricsCache).
+   *
+   * Style sheets (set with setStyleSheetText() or contained in the
+   * rendered XHTML) are always cached after parsing: renderers that
+   * use the same CSS share a single parsed style sheet.
+   */
+  void setFontMetricsCache(const std::shared_ptr<WFontMetricsCache>& cache);
+
+  /*! \brief Returns the cache for font metrics and text measurements.
+   *
+   * \sa setFontMetricsCache()
+   */
+  std::shared_ptr<WFontMetricsCache> fontMetricsCache() const {
+    return fontMetricsCache_;
+  }
+
   /*! \brief Returns the page width.
    *
    * Returns the total page width (in pixel units), including
@@ -322,11 +345,16 @@ private:
   WPaintDevice *device_;
   double fontScale_;
   WString styleSheetText_;
-  std::unique_ptr<StyleSheet> styleSheet_;
+  std::shared_ptr<const StyleSheet> styleSheet_;
+  std::shared_ptr<WFontMetricsCache> fontMetricsCache_;
   std::string error_;
 
   WPainter *painter() const { return painter_; }
 
+  WFontMetrics fontMetrics(WPainter& painter) const;
+  WTextItem measureText(WPainter& painter, const WString& text,
+                        double maxWidth = -1, bool wordWrap = false) const;
+
   friend class Block;
 };
 
@@ -13,6 +13,9 @@
 #include <Wt/WGlobal.h>
 #include <Wt/WAny.h>
 
+#include <map>
+#include <vector>
+
 namespace Wt {
 
   class WDropEvent;
@@ -675,6 +678,72 @@ public:
                ItemDataRole role = ItemDataRole::Edit,
                const WModelIndex& parent = WModelIndex());
 
+  /*! \brief Starts an update.
+   *
+   * Until the matching endUpdate(), the dataChanged() signals of the
+   * model are not emitted, but the changed ranges are merged into as
+   * few rectangles as possible, which are emitted by endUpdate(). This
+   * way, views update themselves only once, for a model in which many
+   * individual items are changed.
+   *
+   * Updates may be nested: the changes are emitted when the outermost
+   * update ends. Pending changes are also emitted before rows or
+   * columns are inserted or removed, and before the
+   * layoutAboutToBeChanged() signal (e.g. when the model is sorted),
+   * and discarded when the model is reset.
+   *
+   * This applies only to changes that the model reports using
+   * notifyDataChanged(), which is the case for all models in the
+   * library.
+   *
+   * \sa endUpdate(), UpdateTransaction
+   */
+  void beginUpdate();
+
+  /*! \brief Ends an update.
+   *
+   * \sa beginUpdate()
+   */
+  void endUpdate();
+
+  /*! \brief Returns whether an update is in progress.
+   *
+   * \sa beginUpdate()
+   */
+  bool isUpdating() const { return updateLevel_ > 0; }
+
+  /*! \brief An update of a model.
+   *
+   * This is a utility class that calls beginUpdate() when created,
+   * and endUpdate() when destroyed:
+   *
+   * \code
+   * {
+   *   Wt::WAbstractItemModel::UpdateTransaction t(*model);
+   *
+   *   for (const auto& quote : quotes)
+   *     model->setData(quote.row, 1, quote.price);
+   * } // views are updated here
+   * \endcode
+   */
+  class WT_API UpdateTransaction
+  {
+  public:
+    /*! \brief Starts an update of the model.
+     */
+    explicit UpdateTransaction(WAbstractItemModel& model);
+
+    /*! \brief Ends the update.
+     */
+    ~UpdateTransaction();
+
+    UpdateTransaction(const UpdateTransaction&) = delete;
+    UpdateTransaction& operator=(const UpdateTransaction&) = delete;
+
+  private:
+    WAbstractItemModel& model_;
+  };
+
   /*! \brief %Signal emitted before a number of columns will be inserted.
    *
    * The first argument is the parent index. The two integer arguments
@@ -765,7 +834,10 @@ public:
    * The two arguments are the model indexes of the top-left and bottom-right
    * data items that span the rectangle of changed data items.
    *
-   * \sa setData()
+   * Models report changes using notifyDataChanged(), which delays
+   * the signal during an update.
+   *
+   * \sa setData(), beginUpdate()
    */
   virtual Signal<WModelIndex, WModelIndex>& dataChanged()
     { return dataChanged_; }
@@ -817,6 +889,17 @@ protected:
    */
   void reset();
 
+  /*! \brief Reports a change of data.
+   *
+   * Emits the dataChanged() signal for the rectangle spanned by \p
+   * topLeft and \p bottomRight, which must have the same parent.
+   *
+   * During an update (see beginUpdate()), the rectangle is instead
+   * merged with the other pending changes.
+   */
+  void notifyDataChanged(const WModelIndex& topLeft,
+                         const WModelIndex& bottomRight);
+
   /*! \brief Creates a model index for the given row and column.
    *
    * Use this method to create a model index. \p ptr is an internal
@@ -919,6 +1002,15 @@ private:
   int first_, last_;
   WModelIndex parent_;
 
+  struct ChangedRange {
+    int top, left, bottom, right;
+  };
+
+  int updateLevel_;
+  std::map<WModelIndex, std::vector<ChangedRange> > pendingChanges_;
+
+  void emitPendingChanges();
+
   Signal<WModelIndex, int, int> columnsAboutToBeInserted_;
   Signal<WModelIndex, int, int> columnsAboutToBeRemoved_;
   Signal<WModelIndex, int, int> columnsInserted_;
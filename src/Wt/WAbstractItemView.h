@@ -1162,6 +1162,8 @@ protected:
   bool hasEditFocus(const WModelIndex& index) const;
 
   void setEditorWidget(const WModelIndex& index, WWidget *editor);
+  WWidget *editorWidget(const WModelIndex& index) const;
+  WModelIndexSet editedIndexes() const;
 
   void bindObjJS(JSlot& slot, const std::string& jsMethod);
   void connectObjJS(EventSignalBase& s, const std::string& jsMethod);
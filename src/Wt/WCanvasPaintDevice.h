@@ -42,6 +42,11 @@ class WTransform;
  * \note To paint an image (WPainter::drawImage()), this requires its
  *       uri.
  *
+ * Paths with many segments are not sent as JavaScript calls with
+ * formatted coordinates, but as a compact binary encoding of single
+ * precision coordinates and segment types, which is decoded and drawn
+ * by the browser.
+ *
  * \sa WAbstractDataInfo
  *
  * \ingroup painting
@@ -141,6 +146,7 @@ private:
   void renderStateChanges(bool resetPathTranslation);
   void resetPathTranslation();
   void drawPlainPath(std::stringstream& s, const WPainterPath& path);
+  std::string encodePath(const WPainterPath& path) const;
   void doDrawImage(const WRectF& rect, const WAbstractDataInfo* info,
                    int imgWidth, int imgHeight, const WRectF& sourceRect);
 
@@ -0,0 +1,303 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WCOLUMNAR_TABLE_MODEL_H_
+#define WCOLUMNAR_TABLE_MODEL_H_
+
+#include <Wt/WAbstractTableModel.h>
+#include <Wt/WDate.h>
+#include <Wt/WString.h>
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace Wt {
+
+/*! \brief Enumeration for the type of a column in a WColumnarTableModel.
+ */
+enum class ColumnType {
+  Int64,  //!< 64-bit integer values (::int64_t)
+  Double, //!< Floating point values (double)
+  String, //!< String values (WString), stored in a per-column dictionary
+  Date    //!< Date values (WDate)
+};
+
+/*! \class WColumnarTableModel Wt/WColumnarTableModel.h Wt/WColumnarTableModel.h
+ *  \brief A compact table model that stores typed columns.
+ *
+ * Unlike WStandardItemModel, which stores every cell as a
+ * WStandardItem with a map of role data, this model stores every
+ * column as a single vector of values of one type, with a bitmap to
+ * mark null values. String columns store every distinct string only
+ * once, and only keep a 32-bit reference per cell. This makes it
+ * suitable for read-mostly tables with many rows.
+ *
+ * Rows are added with appendRow() or appendRows(), and their values
+ * are set by <i>source row</i>, which is the position at which the
+ * row was appended. Sorting (see sort()) and filtering (see
+ * setFilter()) do not move any data, but only change the order and
+ * the selection of the source rows that are presented as the rows of
+ * the model. Use sourceRow() to map a model row to its source row.
+ *
+ * The sorting and filter are applied when they are set: changing a
+ * value afterwards, with one of the setters or with setData(), does
+ * not move the row, nor hide or show it, and sourceRow() keeps
+ * returning the same mapping. Call sort() or setFilter() again to
+ * re-apply them, for example after a batch of updates.
+ *
+ * Values are returned untouched for both the ItemDataRole::Display
+ * and ItemDataRole::Edit roles, which leaves formatting to the view,
+ * unless a format is set for the column with setColumnFormat(). Even
+ * then, the display value is only formatted when it is requested.
+ *
+ * Rows cannot be inserted or removed at arbitrary positions. Use
+ * clear() to remove all rows.
+ *
+ * \ingroup modelview
+ */
+class WT_API WColumnarTableModel : public WAbstractTableModel
+{
+public:
+  /*! \brief Creates a new model without columns.
+   */
+  WColumnarTableModel();
+
+  /*! \brief Destructor.
+   */
+  virtual ~WColumnarTableModel();
+
+  /*! \brief Adds a column.
+   *
+   * All existing rows have a null value for the new column. Returns
+   * the index of the new column.
+   */
+  int addColumn(ColumnType type, const WString& header = WString());
+
+  /*! \brief Returns the type of a column.
+   */
+  ColumnType columnType(int column) const;
+
+  /*! \brief Sets the display format for a column.
+   *
+   * The format is used to convert values for the
+   * ItemDataRole::Display role, using Wt::asString(). This is done
+   * only when the value is requested.
+   *
+   * By default, the format is empty, and data() returns the typed
+   * value for the display role.
+   */
+  void setColumnFormat(int column, const WString& format);
+
+  /*! \brief Returns the display format for a column.
+   *
+   * \sa setColumnFormat()
+   */
+  WString columnFormat(int column) const;
+
+  /*! \brief Reserves storage for a number of rows.
+   */
+  void reserve(int rows);
+
+  /*! \brief Appends a row.
+   *
+   * The new row has a null value in all columns, and is shown as the
+   * last row of the model, regardless of the current sorting and
+   * filter. Returns the source row of the new row.
+   */
+  int appendRow();
+
+  /*! \brief Appends rows.
+   *
+   * Like appendRow(), but for \p count rows at once. Returns the
+   * source row of the first new row.
+   */
+  int appendRows(int count);
+
+  /*! \brief Removes all rows.
+   *
+   * The columns, and the sort column and filter are kept.
+   */
+  void clear();
+
+  /*! \brief Returns the number of source rows.
+   *
+   * This is the number of rows that were appended, including rows
+   * that are hidden by the filter.
+   */
+  int sourceRowCount() const { return sourceRowCount_; }
+
+  /*! \brief Maps a model row to a source row.
+   */
+  int sourceRow(int row) const;
+
+  /*! \brief Sets an integer value.
+   *
+   * The column must be of type ColumnType::Int64.
+   *
+   * Like all setters, this does not re-apply the sorting or filter.
+   */
+  void setInt64(int sourceRow, int column, ::int64_t value);
+
+  /*! \brief Sets a floating point value.
+   *
+   * The column must be of type ColumnType::Double.
+   */
+  void setDouble(int sourceRow, int column, double value);
+
+  /*! \brief Sets a string value.
+   *
+   * The column must be of type ColumnType::String.
+   */
+  void setString(int sourceRow, int column, const WString& value);
+
+  /*! \brief Sets a date value.
+   *
+   * The column must be of type ColumnType::Date. An invalid or null
+   * \p value sets a null value.
+   */
+  void setDate(int sourceRow, int column, const WDate& value);
+
+  /*! \brief Sets a null value.
+   */
+  void setNull(int sourceRow, int column);
+
+  /*! \brief Returns whether a value is null.
+   */
+  bool isNull(int sourceRow, int column) const;
+
+  /*! \brief Returns an integer value.
+   *
+   * Returns 0 for a null value.
+   */
+  ::int64_t int64Value(int sourceRow, int column) const;
+
+  /*! \brief Returns a floating point value.
+   *
+   * Returns 0 for a null value.
+   */
+  double doubleValue(int sourceRow, int column) const;
+
+  /*! \brief Returns a string value.
+   *
+   * Returns an empty string for a null value.
+   */
+  const WString& stringValue(int sourceRow, int column) const;
+
+  /*! \brief Returns a date value.
+   *
+   * Returns a null date for a null value.
+   */
+  WDate dateValue(int sourceRow, int column) const;
+
+  /*! \brief Sets a filter.
+   *
+   * Only source rows for which \p filter returns \c true are shown
+   * as rows of the model. The filter is evaluated once for every
+   * source row, and the model is reset.
+   *
+   * Pass an empty function to remove the filter.
+   */
+  void setFilter(const std::function<bool (int sourceRow)>& filter);
+
+  virtual int columnCount(const WModelIndex& parent = WModelIndex())
+    const override;
+  virtual int rowCount(const WModelIndex& parent = WModelIndex())
+    const override;
+
+  using WAbstractTableModel::data;
+  using WAbstractTableModel::setData;
+
+  virtual cpp17::any data(const WModelIndex& index,
+                          ItemDataRole role = ItemDataRole::Display)
+    const override;
+
+  /*! \brief Sets data.
+   *
+   * Only the ItemDataRole::Edit role is supported. The value is
+   * converted to the type of the column. An empty \p value sets a
+   * null value.
+   *
+   * Returns \c false if the value cannot be converted without loss,
+   * such as a number with a fraction for a ColumnType::Int64 column.
+   * The sorting and filter are not re-applied.
+   */
+  virtual bool setData(const WModelIndex& index, const cpp17::any& value,
+                       ItemDataRole role = ItemDataRole::Edit) override;
+
+  virtual cpp17::any headerData(int section,
+                                Orientation orientation = Orientation::Horizontal,
+                                ItemDataRole role = ItemDataRole::Display)
+    const override;
+
+  virtual bool setHeaderData(int section, Orientation orientation,
+                             const cpp17::any& value,
+                             ItemDataRole role = ItemDataRole::Edit) override;
+
+  /*! \brief Sorts the model.
+   *
+   * Sorts the rows on the values of \p column. Rows with equal
+   * values keep their source row order. A null value is considered
+   * smaller than all other values: null values come first in
+   * ascending order, and last in descending order. String columns
+   * sort by comparing the distinct strings once, after which rows are
+   * sorted on their rank.
+   *
+   * This also re-applies the filter.
+   *
+   * Use a \p column of -1 to restore the source row order.
+   */
+  virtual void sort(int column,
+                    SortOrder order = SortOrder::Ascending) override;
+
+private:
+  struct Column {
+    ColumnType type;
+    WString header;
+    WString format;
+
+    std::vector< ::int64_t> ints;
+    std::vector<double> doubles;
+    std::vector<int> days;
+    std::vector<unsigned> codes;
+    std::vector<WString> dictionary;
+    std::unordered_map<std::string, unsigned> dictionaryIndex;
+
+    std::vector< ::uint64_t> nulls;
+
+    explicit Column(ColumnType aType) : type(aType) { }
+
+    void resize(int rows);
+    bool isNull(int row) const {
+      return (nulls[row >> 6] >> (row & 63)) & 1;
+    }
+    void setNull(int row, bool isNull);
+  };
+
+  std::vector<Column> columns_;
+  int sourceRowCount_;
+
+  // Model row -> source row and back, unless identity_
+  std::vector<int> rows_, sourceRows_;
+  bool identity_;
+
+  std::function<bool (int)> filter_;
+  int sortColumn_;
+  SortOrder sortOrder_;
+
+  Column& column(int column, ColumnType type);
+  const Column& column(int column) const;
+  void checkSourceRow(int sourceRow) const;
+  void sourceDataChanged(int sourceRow, int column);
+  void updateRows();
+  void sortRows();
+  cpp17::any value(int sourceRow, int column) const;
+};
+
+}
+
+#endif // WCOLUMNAR_TABLE_MODEL_H_
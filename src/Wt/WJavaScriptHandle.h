@@ -153,8 +153,49 @@ public:
     (*value_) = v;
 
     value_->clientBinding_ = binding;
-    if (changed)
+    if (changed) {
       value_->clientBinding_->context_->dirty_[id_] = true;
+      value_->clientBinding_->context_->updates_[id_].clear();
+    }
+  }
+
+  /*! \brief Set the value for this handle, with an incremental update.
+   *
+   * Like setValue(), but instead of the complete value, only the
+   * JavaScript expression \p jsUpdate is sent to the client. This
+   * expression should compute \p v from the current client side value
+   * (see jsRef()), and is assigned to the handle in the same way as a
+   * complete value. This avoids sending a large value, like a
+   * WPainterPath, again when only a small part of it changed.
+   *
+   * If the value was already changed with setValue() since it was
+   * last synced, the complete value is sent instead.
+   *
+   * \throw WException The handle is \link isValid() invalid\endlink
+   * \throw WException Trying to assign a JavaScript bound value
+   */
+  void setValue(const T& v, const std::string& jsUpdate)
+  {
+    if (!value_) {
+      throw WException("Can't assign a value to an invalid handle!");
+    }
+    if (v.isJavaScriptBound()) throw WException("Can not assign a JavaScript bound value to a WJavaScriptHandle!");
+    bool fullUpdate = value_->clientBinding_->context_->dirty_[id_] &&
+      value_->clientBinding_->context_->updates_[id_].empty();
+
+    WJavaScriptExposableObject::JSInfo *binding = value_->clientBinding_;
+    value_->clientBinding_ = nullptr;
+
+    bool changed = !value_->closeTo(v);
+    (*value_) = v;
+
+    value_->clientBinding_ = binding;
+    if (changed && !fullUpdate) {
+      auto context = value_->clientBinding_->context_;
+      context->dirty_[id_] = true;
+      context->updates_[id_] += context->jsRef() + ".setJsValue("
+        + std::to_string(id_) + "," + jsUpdate + ");";
+    }
   }
 
   /*! \brief Get the value for this handle.
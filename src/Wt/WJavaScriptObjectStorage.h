@@ -11,6 +11,7 @@
 #include "Wt/WJavaScriptHandle.h"
 
 #include <string>
+#include <vector>
 
 namespace Wt {
 
@@ -48,6 +49,7 @@ private:
 
   std::vector<WJavaScriptExposableObject *> jsValues_;
   std::vector<bool> dirty_;
+  std::vector<std::string> updates_;
   WWidget *widget_;
 };
 
@@ -143,9 +143,24 @@ public:
    *
    * When using Base-14 fonts, WString::narrow() will be called on text
    * which may result in loss of information.
+   *
+   * \sa clearFontCollectionCache()
    */
   void addFontCollection(const std::string& directory, bool recursive=true);
 
+  /*! \brief Clears the cached font matches of font collections.
+   *
+   * Without libpango, the fonts that are found in the directories
+   * added with addFontCollection() are cached for all paint device
+   * instances, since scanning a directory is expensive. Fonts that are
+   * installed in such a directory while the application is running
+   * are therefore not found until this method is called.
+   *
+   * If %Wt has been configured to use <tt>libpango</tt>, this method
+   * has no effect.
+   */
+  static void clearFontCollectionCache();
+
 #ifdef WT_TARGET_JAVA
   void setDeviceTransform(const WTransform& deviceTransform);
 #endif //WT_TARGET_JAVA
@@ -107,9 +107,24 @@ public:
    * specific characters. Most truetype fonts provided only partial
    * unicode support. The provided \p directory will be searched for
    * fonts (currently only TrueType ".ttf" or ".ttc" fonts).
+   *
+   * \sa clearFontCollectionCache()
    */
   void addFontCollection(const std::string& directory, bool recursive=true);
 
+  /*! \brief Clears the cached font matches of font collections.
+   *
+   * Without libpango, the fonts that are found in the directories
+   * added with addFontCollection() are cached for all paint device
+   * instances, since scanning a directory is expensive. Fonts that are
+   * installed in such a directory while the application is running
+   * are therefore not found until this method is called.
+   *
+   * If %Wt has been configured to use <tt>libpango</tt>, this method
+   * has no effect.
+   */
+  static void clearFontCollectionCache();
+
   virtual WFlags<PaintDeviceFeatureFlag> features() const override;
   virtual void setChanged(WFlags<PainterChangeFlag> flags) override;
   virtual void drawArc(const WRectF& rect, double startAngle,
@@ -118,6 +118,16 @@ public:
   {
     int64_t     processId; //!< The process id of the process the session is running in.
     std::string sessionId; //!< The session id.
+
+    /*! \brief The heap memory used by the session, in bytes.
+     *
+     * This is -1 unless %Wt was built with
+     * ENABLE_SESSION_MEMORY_ACCOUNTING, and the session runs in this
+     * process.
+     *
+     * \sa WServer::memoryUsage()
+     */
+    int64_t     memoryUsage = -1;
   };
 #endif // WT_TARGET_JAVA
 
@@ -537,6 +547,49 @@ public:
    */
   WT_API void postAll(const std::function<void ()>& function);
 
+  /*! \brief Subscribes a session to a broadcast topic.
+   *
+   * The session, identified by its WApplication::sessionId(), will
+   * receive the functions that are broadcast() to \p topic. A
+   * session is unsubscribed automatically when it is terminated, and
+   * its subscriptions follow it when its session id changes.
+   *
+   * \sa unsubscribe(), broadcast()
+   */
+  WT_API void subscribe(const std::string& topic,
+                        const std::string& sessionId);
+
+  /*! \brief Unsubscribes a session from a broadcast topic.
+   *
+   * \sa subscribe()
+   */
+  WT_API void unsubscribe(const std::string& topic,
+                          const std::string& sessionId);
+
+  /*! \brief Posts a function to all sessions subscribed to a topic.
+   *
+   * This is like post(), but for every session that is subscribed to
+   * \p topic. Rather than posting a separate event for every session,
+   * the sessions are delivered in batches, using at most as many
+   * tasks as there are threads in the thread pool, so that a
+   * broadcast to many sessions does not starve other work.
+   *
+   * If \p coalesce is \c true, then the function is dropped for
+   * sessions that have not yet run it when a newer broadcast is made
+   * to the same topic. This is useful when each broadcast carries the
+   * complete latest state (e.g. a price ticker), and intermediate
+   * updates may be skipped for sessions that are lagging behind.
+   *
+   * \note Broadcasts are local to this server process, and thus do
+   *       not reach sessions when using the dedicated process
+   *       session policy.
+   *
+   * \sa subscribe(), postAll()
+   */
+  WT_API void broadcast(const std::string& topic,
+                        const std::function<void ()>& function,
+                        bool coalesce = false);
+
   /*! \brief Schedules a function to be executed in a session.
    *
    * The \p function will run in the session specified by \p sessionId,
@@ -622,6 +675,28 @@ public:
    */
   WTCONNECTOR_API std::vector<SessionInfo> sessions() const;
 
+  /*! \brief Returns the heap memory used by all sessions, in bytes.
+   *
+   * When %Wt is built with ENABLE_SESSION_MEMORY_ACCOUNTING, heap
+   * allocations that are made while handling a session (in requests,
+   * posted events, and while constructing or destroying the
+   * application) are charged to that session until they are freed.
+   * Memory that is shared between sessions is charged to the session
+   * that allocated it.
+   *
+   * This returns the sum for all sessions in this process, or -1 if
+   * memory accounting is not enabled. The sum is kept as a running
+   * total, which includes memory of sessions that have ended but is
+   * still allocated, and which is accurate up to 16 kB per session.
+   * The usage per session is available through sessions().
+   *
+   * The memory that a session may use, and that all sessions may use
+   * together, can be limited in the configuration, with
+   * <tt>\<max-memory-per-session\></tt> and
+   * <tt>\<max-memory\></tt> in <tt>\<session-management\></tt>.
+   */
+  WT_API int64_t memoryUsage() const;
+
   void updateProcessSessionId(const std::string& sessionId);
 
   /*! \brief Returns the logger instance.
@@ -9,6 +9,7 @@
 
 #include <Wt/WAbstractProxyModel.h>
 #include <regex>
+#include <typeinfo>
 
 namespace Wt {
 
@@ -219,6 +220,30 @@ public:
    */
   bool dynamicSortFilter() const { return dynamic_; }
 
+  /*! \brief Configures caching of sort keys.
+   *
+   * When \p enable is \c true, the sortRole() data of the sort column
+   * is read only once for every source row, and kept in a cache. When
+   * all values have the same arithmetic type, or are all WString
+   * values, they are cached with that type, which makes comparisons
+   * considerably cheaper than comparing the data of two indexes. The
+   * cache is updated incrementally as rows are inserted, removed or
+   * changed in the source model.
+   *
+   * The cached keys are compared using the same ordering as the
+   * default implementation of lessThan(), which is therefore not
+   * called. Do not enable this if you have reimplemented lessThan().
+   *
+   * The default value is \c false.
+   */
+  void setCacheSortKeys(bool enable);
+
+  /*! \brief Returns whether sort keys are cached.
+   *
+   * \sa setCacheSortKeys()
+   */
+  bool cacheSortKeys() const { return cacheSortKeys_; }
+
   /*! \brief Invalidates the current filter.
    *
    * This refilters and resorts the model, and is useful only if you
@@ -317,11 +342,31 @@ private:
   /*
    * For every proxy parent, we keep the following info:
    */
+  /*
+   * Sort keys of the source rows, when cacheSortKeys() is enabled.
+   * Number and String keys are used when all values have that same
+   * type, otherwise the data is cached as is.
+   */
+  struct SortKeys {
+    enum class Type { None, Number, String, Any };
+
+    SortKeys() : type(Type::None), numberType(nullptr) { }
+
+    Type type;
+    const std::type_info *numberType;
+    std::vector<double> numbers;
+    std::vector<WString> strings;
+    std::vector<cpp17::any> values;
+    std::vector<bool> hasValue;
+  };
+
   struct Item : public BaseItem {
     // maps source rows to proxy rows
     std::vector<int> sourceRowMap_;
     // maps proxy rows to source rows
     std::vector<int> proxyRowMap_;
+    // sort keys for source rows
+    SortKeys sortKeys_;
 
     Item(const WModelIndex& sourceIndex) : BaseItem(sourceIndex) { }
     virtual ~Item();
@@ -349,7 +394,7 @@ private:
   int sortKeyColumn_;
   ItemDataRole sortRole_;
   SortOrder sortOrder_;
-  bool dynamic_, inserting_;
+  bool dynamic_, inserting_, cacheSortKeys_;
 
   std::vector<Wt::Signals::connection> modelConnections_;
   mutable ItemMap mappedIndexes_;
@@ -386,8 +431,18 @@ private:
   void resetMappings();
   void updateItem(Item *item) const;
   void rebuildSourceRowMap(Item *item) const;
+  void updateSourceRowMap(Item *item, int fromProxyRow) const;
+  void insertProxyRow(Item *item, int proxyRow, int sourceRow) const;
+  void removeProxyRow(Item *item, int proxyRow) const;
 
   int mappedInsertionPoint(int sourceRow, Item *item) const;
+  int mappedMovePoint(int sourceRow, int oldProxyRow, Item *item) const;
+
+  void buildSortKeys(Item *item, bool any) const;
+  void insertSortKeys(Item *item, int start, int count) const;
+  void removeSortKeys(Item *item, int start, int count) const;
+  void updateSortKey(Item *item, int sourceRow) const;
+  int compareSortKeys(const Item *item, int sourceRow1, int sourceRow2) const;
 #ifndef WT_TARGET_JAVA
   int compare(const WModelIndex& lhs, const WModelIndex& rhs) const;
 #endif
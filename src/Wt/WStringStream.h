@@ -126,6 +126,27 @@ public:
    */
   WStringStream& operator<< (const std::string& s);
 
+  /*! \brief Appends the contents of another string stream.
+   *
+   * The buffers of \p s are appended one by one, without first
+   * concatenating them into a temporary string. When this stream has
+   * an std::ostream sink, the buffers are written directly to the sink.
+   *
+   * The behaviour is only defined when \p s has internal buffering.
+   */
+  WStringStream& operator<< (const WStringStream& s);
+
+  /*! \brief Moves the contents of another string stream to the end.
+   *
+   * Heap-allocated buffers of \p other are transferred instead of
+   * copied, which makes this a cheap operation regardless of the
+   * length of \p other. Afterwards, \p other is empty.
+   *
+   * The behaviour is only defined when both streams have internal
+   * buffering. Otherwise, the contents is copied.
+   */
+  void splice(WStringStream& other);
+
   /*! \brief Appends a boolean.
    *
    * This is written to the stream as <tt>true</tt> or <tt>false</tt>.
@@ -10,10 +10,13 @@
 #include <Wt/WAbstractItemView.h>
 #include <Wt/WContainerWidget.h>
 
+#include <set>
+
 namespace Wt {
 
   class WContainerWidget;
   class WModelIndex;
+  class WStringStream;
 
 /*! \class WTableView Wt/WTableView.h Wt/WTableView.h
  *  \brief An MVC View widget for tabular data.
@@ -79,6 +82,9 @@ namespace Wt {
  * a layout manager or by setHeight()), then it will grow according
  * to the size of the model.
  *
+ * For large models that contain only plain text, you may let the
+ * browser render the rows, see setClientRowRendering().
+ *
  * \ingroup modelview
  */
 class WT_API WTableView : public WAbstractItemView
@@ -155,6 +161,43 @@ public:
   virtual void setHidden(bool hidden,
                          const WAnimation& animation = WAnimation()) override;
 
+  /*! \brief Configures client-side rendering of rows.
+   *
+   * By default, every cell is rendered by the item delegate as a
+   * widget, which is created and deleted again while the user scrolls
+   * through the table.
+   *
+   * When enabled, the view instead sends the ItemDataRole::Display
+   * text and the ItemDataRole::StyleClass of the cells in the rendered
+   * area as compact row data to the browser, which creates the cells
+   * itself. Only cells that are being edited are rendered as widgets,
+   * using the item delegate.
+   *
+   * This considerably reduces the server-side work and the size of
+   * the updates when scrolling through a large model, but all other
+   * roles (such as icons, check boxes, tool tips and links) and
+   * custom item delegates are ignored for cells that are not being
+   * edited, and text is always rendered as plain text. In this mode,
+   * itemWidget() returns only the editor widgets, and keyboard
+   * navigation between editors and drops on items or between rows are
+   * not supported.
+   *
+   * Unlike with widget rendering, the model data is read column per
+   * column.
+   *
+   * This setting has no effect when the view is rendered in plain
+   * HTML mode.
+   *
+   * The default value is \c false.
+   */
+  void setClientRowRendering(bool enabled);
+
+  /*! \brief Returns whether rows are rendered client-side.
+   *
+   * \sa setClientRowRendering()
+   */
+  bool clientRowRendering() const { return clientRowRendering_; }
+
   /*! \brief Returns the model index corresponding to a widget.
    *
    * This returns the model index for the item that is or contains the
@@ -236,12 +279,21 @@ private:
   public:
     int column() const { return column_; }
 
+    /* The container with the client-side rendered rows, or nullptr */
+    WContainerWidget *rows() const { return rows_; }
+
   private:
     ColumnWidget(int column);
 
     int column_;
 
-    friend ColumnWidget *WTableView::createColumnWidget(int column);
+    /* Client-side rendering: the rows present in rows_, and rows
+     * that need to be sent again */
+    WContainerWidget *rows_;
+    int rowsFirst_, rowsLast_;
+    std::set<int> dirtyRows_;
+
+    friend class WTableView;
   };
 
   /* For Ajax implementation */
@@ -283,6 +335,7 @@ private:
   int scrollToCol_;
   ScrollHint scrollToRowHint_, scrollToColHint_;
   bool columnResizeConnected_;
+  bool clientRowRendering_;
 
   void updateTableBackground();
 
@@ -355,6 +408,12 @@ private:
   void updateItem(const WModelIndex& index,
                   int renderedRow, int renderedColumn);
 
+  void renderClientRows();
+  void renderClientCell(WStringStream& s, const WModelIndex& index);
+  void updateClientEditors();
+  void persistClientEditors(ColumnWidget *column);
+  void invalidateClientRows();
+
   virtual bool internalSelect(const WModelIndex& index, SelectionFlag option)
     override;
   virtual void selectRange(const WModelIndex& first, const WModelIndex& last)
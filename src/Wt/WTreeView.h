@@ -251,7 +251,18 @@ private:
 
   bool skipNextMouseEvent_;
 
+  /*
+   * The subtree heights of the children of a node, as a Fenwick
+   * tree, so that the row of a child and the child at a row can be
+   * found in O(log n).
+   */
+  struct ChildHeights {
+    std::vector<int> tree;
+    int total;
+  };
+
   std::unordered_set<WModelIndex> expandedSet_;
+  mutable std::unordered_map<WModelIndex, ChildHeights> childHeights_;
   NodeMap renderedNodes_;
   bool renderedNodesAdded_;
   WTreeViewNode *rootNode_;
@@ -358,9 +369,10 @@ private:
   WWidget *widgetForIndex(const WModelIndex& index) const;
   WTreeViewNode *nodeForIndex(const WModelIndex& index) const;
 
-  int subTreeHeight(const WModelIndex& index,
-                    int lowerBound = 0,
-                    int upperBound = std::numeric_limits<int>::max()) const;
+  int subTreeHeight(const WModelIndex& index) const;
+  const ChildHeights& childHeights(const WModelIndex& index) const;
+  int childRowsBefore(const WModelIndex& parent, int row) const;
+  void updateSubTreeHeight(const WModelIndex& index);
   int renderedRow(const WModelIndex& index,
                   WWidget *w,
                   int lowerBound = 0,
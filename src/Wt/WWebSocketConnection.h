@@ -83,6 +83,24 @@ enum class ReadingState
   SkipData = 3,
 };
 
+// Compresses and decompresses messages with the permessage-deflate
+// extension (RFC 7692), using the parameters negotiated in the
+// handshake. Deflating and inflating use separate contexts, and may be
+// called from different threads.
+class WT_API WebSocketCompression
+{
+public:
+  virtual ~WebSocketCompression();
+
+  // Appends the compressed message to out, without the trailing
+  // empty block.
+  virtual bool deflate(const char* data, std::size_t size, std::string& out) = 0;
+  // Appends the decompressed message to out. Fails when the result
+  // would exceed maxSize bytes.
+  virtual bool inflate(const char* data, std::size_t size, std::string& out,
+                       std::size_t maxSize) = 0;
+};
+
 class WT_API WebSocketConnection : public std::enable_shared_from_this<WebSocketConnection>
 {
 public:
@@ -97,22 +115,38 @@ public:
   void startReading();
   // Performs an async write to the socket, inside the write-done loop.
   bool doAsyncWrite(OpCode type, const std::vector<char>& frameHeader, const std::vector<char>& data = {});
+  bool doAsyncWrite(OpCode type, const char* frameHeader, std::size_t headerSize,
+                    const char* data, std::size_t dataSize);
+  // Writes a text or binary message as a single frame, inside the
+  // write-done loop. The message is compressed if compression was
+  // negotiated.
+  bool doAsyncWriteMessage(OpCode type, const char* data, std::size_t dataSize);
   // Performs an async write to the socket, outside the write-done loop.
   // This will schedule the write to happen on the strand, which will execute ones the socket is no longer
   // busy writing (or "immediately" if it isn't busy. This will not trigger the callback (hasDataWrittenCallback_)
   // so the WWebsocketResource isn't aware of this frame being sent, since it will not be notified.
   void doControlFrameWrite(const std::vector<char>& frameHeader, OpCode opcode);
+  void doControlFrameWrite(const char* frameHeader, std::size_t headerSize, OpCode opcode);
 
-  void setDataReadCallback(const std::function<void()>& callback);
+  // The callback receives the unmasked payload of a frame. It may
+  // take the contents of the string, which is reused for the next frame.
+  void setDataReadCallback(const std::function<void(std::string&)>& callback);
   void setDataWrittenCallback(const std::function<void(const AsioWrapper::error_code&, std::size_t)>& callback);
 
   WebSocketFrameHeader* header() const { return header_.get(); }
-  const WStringStream& dataBuffer() const { return dataBuffer_; }
 
   bool isOpen();
 
   void setMaximumReceivedFrameSize(std::size_t frameSize);
   void setMaximumReceivedMessageSize(std::size_t messageSize);
+  // Number of frames that may be queued (inside the write-done loop)
+  // while a frame is being written.
+  void setWriteQueueSize(std::size_t queueSize);
+
+  // Enables permessage-deflate, before the connection starts reading
+  void setCompression(std::unique_ptr<WebSocketCompression> compression);
+  // Decompresses a received message in place
+  bool inflateMessage(std::string& message, std::size_t maxSize);
 
   bool skipMessage() const { return skipMessage_; }
 
@@ -139,51 +173,72 @@ private:
   ReadingState readingState_;
   bool skipMessage_;
   std::unique_ptr<WebSocketFrameHeader> header_;
-  WStringStream dataBuffer_;
+
+  // The payload of the frame being received. A payload that does not
+  // fit in readBuffer_ is read directly into it (readingPayload_), past
+  // payloadReceived_ bytes.
+  std::string frame_;
+  bool readingPayload_;
+  std::size_t payloadReceived_;
 
   // Continuation skipping & size
   bool isContinuation_;
   std::size_t continuationSize_;
 
-  // Socket state, part of the regular flow (write - done).
-  bool isWriting_;
+  struct QueuedFrame {
+    OpCode type;
+    bool inWriteLoop;
+    std::size_t size;
+  };
 
-  // Socket state, part of the control system, outside the normal flow.
-  bool isWritingToSocket_;
-  // Socket writing mutex, guarding (control) writing state, which can
-  // be set by sendMessage or ping-pong frames.
-  // It guards:
-  //  - isWritingToSocket_
-  //  - hasPendingDataWrite_
-  //  - hasPendingPingWrite_
-  //  - hasPendingPingWrite_
-  //  - pendingWriteDataType_
-  //  - pendingWritePingBuffer_
-  //  - pendingWritePongBuffer_
-  //  - pendingWriteDataBuffer_
+  // Guards all writing state below, since frames are queued from any
+  // thread (sendMessage, ping-pong) while writes complete on the strand.
   std::mutex writingMutex_;
 
-  // Writing buffer. Necessary for delayed frames, so that data isn't lost,
-  // since `const_buffer` does NOT own its underlying data.
+  // Frames that are being written to the socket. The buffer owns the
+  // data until the write completes, since `const_buffer` does NOT own
+  // its underlying data.
+  bool isWritingToSocket_;
   WStringStream writeBuffer_;
-  // Temporary writing storage, when sending collides with other socket
-  // operation. The type will indicate the delayed request type.
-  // In case of Ping or Pong, the respective buffer will be used.
-  // In case of other frames, the data buffer will be used.
-  bool hasPendingDataWrite_;
-  bool hasPendingPingWrite_;
-  bool hasPendingPongWrite_;
-  OpCode pendingWriteDataType_;
-  std::vector<AsioWrapper::asio::const_buffer> pendingWritePingBuffer_;
-  std::vector<AsioWrapper::asio::const_buffer> pendingWritePongBuffer_;
-  std::vector<AsioWrapper::asio::const_buffer> pendingWriteDataBuffer_;
-
-  std::function<void()> hasDataReadCallback_;
+  std::vector<QueuedFrame> writingFrames_;
+
+  // Frames that were queued while the socket was busy. These are all
+  // written together, in a single write, once the current write is done.
+  WStringStream queuedBuffer_;
+  std::vector<QueuedFrame> queuedFrames_;
+
+  // Frames inside the write-done loop that are queued or being written,
+  // and the number that may be queued on top of the one being written.
+  std::size_t pendingFrames_;
+  std::size_t writeQueueSize_;
+
+  // Set when a write failed, after which nothing more is written
+  AsioWrapper::error_code writeError_;
+
+  // permessage-deflate, if negotiated. Messages are deflated (into
+  // deflateBuffer_) while holding writingMutex_, in the order in
+  // which they are sent, and inflated on the strand.
+  std::unique_ptr<WebSocketCompression> compression_;
+  bool compressMessages_;
+  std::string deflateBuffer_;
+  std::string inflateBuffer_;
+
+  std::function<void(std::string&)> hasDataReadCallback_;
   std::function<void(const AsioWrapper::error_code&, std::size_t)> hasDataWrittenCallback_;
 
   void doAsyncRead(char* buffer, size_t size);
-  std::size_t parseBuffer(const char* begin, const char* end);
+  std::size_t parseBuffer(char* begin, const char* end);
+  void unmask(char* data, std::size_t size, std::size_t offset);
   void doEmitAndCleanBuffers();
+
+  bool queueFrame(OpCode type, bool inWriteLoop,
+                  const char* frameHeader, std::size_t headerSize,
+                  const char* data, std::size_t dataSize);
+  bool reserveFrame(OpCode type, bool inWriteLoop);
+  void appendFrame(OpCode type, bool inWriteLoop,
+                   const char* frameHeader, std::size_t headerSize,
+                   const char* data, std::size_t dataSize);
+  void startSocketWrite();
 };
 
 class WT_API WebSocketTcpConnection final : public WebSocketConnection
@@ -412,12 +467,22 @@ public:
    */
   void setPingTimeout(int pingInterval, int pingTimeout);
 
+  /*! \brief Sets the number of messages that can be queued.
+   *
+   * \sa WWebSocketResource::setWriteQueueSize
+   */
+  void setWriteQueueSize(std::size_t queueSize);
+
   /*! \brief Signal indicating a sending event has been completed.
    *
    * The error code it returns either does not exists, indicating a
    * successful write. Or it can exist, and will then have a value.
    * The number of the value signifies which type of error has occurred.
    * This can leave the underlying stream useless.
+   *
+   * When a write fails, the messages that were queued behind it (see
+   * setWriteQueueSize()) are dropped: done() is emitted for each of
+   * them with the same error, and subsequent sends return \p false.
    */
   Signal<AsioWrapper::error_code>& done() { return done_; }
 
@@ -448,10 +513,10 @@ private:
   bool sendEmptyFrame(OpCode opcode);
   // Send an empty frame OUTSIDE the write-done loop (blocking async write & done() signal)
   bool sendControlFrame(OpCode opcode);
-  bool sendDataFrame(const std::vector<char>& buffer, OpCode opcode);
+  bool sendDataFrame(const char* data, std::size_t size, OpCode opcode);
 
   void writeFrame(const AsioWrapper::error_code& e, std::size_t bytes_transferred);
-  void receiveFrame();
+  void receiveFrame(std::string& data);
 
   void startPingTimer();
   void doSendPing(const AsioWrapper::error_code& e);
@@ -470,11 +535,14 @@ private:
   int pingInterval_;
   int pingTimeout_;
 
+  std::size_t writeQueueSize_;
+
   AsioWrapper::asio::steady_timer pingSignalTimer_;
   AsioWrapper::asio::steady_timer pongTimeoutTimer_;
 
-  WStringStream continuationBuffer_;
+  std::string continuationBuffer_;
   OpCode continuationOpCode_;
+  bool continuationCompressed_;
 
   friend class WebSocketHandlerResource;
 };
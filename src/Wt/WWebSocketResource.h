@@ -56,8 +56,11 @@ private:
  * This resource enables the creation of endpoints that can be accessed
  * to set up WebSocket connections. This implementation adheres to
  * <a href="https://datatracker.ietf.org/doc/html/rfc6455">RFC-6455</a>.
- * The implementation does not support Sec-WebSocket-Protocol or
- * Sec-WebSocket-Extension.
+ * The implementation does not support Sec-WebSocket-Protocol. The only
+ * supported Sec-WebSocket-Extension is permessage-deflate
+ * (<a href="https://datatracker.ietf.org/doc/html/rfc7692">RFC-7692</a>),
+ * when the built-in httpd is compiled with zlib and compression is not
+ * disabled.
  *
  * Like WResource, a WWebSocketResource can be global (aka static) or
  * session-private (aka dynamic).
@@ -227,6 +230,22 @@ public:
    */
   void setPingTimeout(int intervalSeconds, int timeoutSeconds);
 
+  /*! \brief Sets the number of messages that can be queued.
+   *
+   * By default (a \p size of 0), a connection only accepts a new
+   * message after the WWebSocketConnection::done() signal was emitted
+   * for the previous one.
+   *
+   * With a larger \p size, up to this many messages can be sent while
+   * a previous message is still being written. They are queued, and
+   * written together in a single write as soon as the socket is
+   * available. This greatly reduces the number of system calls when
+   * many small messages are sent. The done() signal is still emitted
+   * once for every message. When the queue is full,
+   * WWebSocketConnection::sendMessage() returns \p false.
+   */
+  void setWriteQueueSize(std::size_t size);
+
   /*! \brief Returns the maximum size of a single received frame.
    *
    * \sa setMaximumReceivedSize
@@ -260,6 +279,12 @@ public:
    */
   int pingTimeout() const { return pingTimeout_; }
 
+  /*! \brief Returns the number of messages that can be queued.
+   *
+   * \sa setWriteQueueSize
+   */
+  std::size_t writeQueueSize() const { return writeQueueSize_; }
+
   // Wt internal
   std::shared_ptr<WebSocketHandlerResource> handleResource() const { return resource_; }
 
@@ -280,6 +305,8 @@ private:
   int pingInterval_;
   int pingTimeout_;
 
+  std::size_t writeQueueSize_;
+
   WApplication* app_ = nullptr;
 
   friend class WebSocketHandlerResource;
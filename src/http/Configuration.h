@@ -56,6 +56,9 @@ public:
   const std::string& pidPath() const { return pidPath_; }
   const std::string& serverName() const { return serverName_; }
   bool compression() const { return compression_; }
+  int webSocketDeflateWindowBits() const { return webSocketDeflateWindowBits_; }
+  bool webSocketDeflateContextTakeover() const
+    { return webSocketDeflateContextTakeover_; }
   bool gdb() const { return gdb_; }
   const std::string& configPath() const { return configPath_; }
   const std::string& fileExtMapPath() const { return fileExtMapPath_; }
@@ -113,6 +116,8 @@ private:
   std::string pidPath_;
   std::string serverName_;
   bool compression_;
+  int webSocketDeflateWindowBits_;
+  bool webSocketDeflateContextTakeover_;
   bool gdb_;
   std::string configPath_;
   std::string fileExtMapPath_;
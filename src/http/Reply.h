@@ -183,6 +183,8 @@ protected:
   ConnectionPtr connection() const { return connection_; }
   bool transmitting() const { return transmitting_; }
   asio::const_buffer buf(const std::string &s);
+  // a buffer of the given size, owned by the reply until the write completes
+  std::string& allocBuf(std::size_t size);
 
 private:
 
@@ -90,7 +90,8 @@ public:
   struct PerMessageDeflateState {
     bool enabled;
     int client_max_window_bits; // -1 means no context takeover
-    int server_max_window_bits; // -1 means no context takeover
+    int server_max_window_bits;
+    bool server_no_context_takeover;
   };
 #endif
 
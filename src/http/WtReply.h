@@ -87,6 +87,8 @@ protected:
 #ifdef WTHTTP_WITH_ZLIB
   std::vector<asio::const_buffer> compressedBuffers_;
   bool deflateInitialized_;
+  // totals for permessage-deflate, reported when the connection closes
+  ::int64_t deflateInputSize_, deflateOutputSize_;
 #endif
 
   virtual std::string contentType() override;
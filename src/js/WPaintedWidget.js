@@ -67,6 +67,24 @@ WT_DECLARE_WT_MEMBER(
           }
         );
       };
+      // Decode a path encoded by WCanvasPaintDevice: the number of segments
+      // (uint32), their coordinates (float32 pairs) and their types (uint8),
+      // all little endian, in base64
+      this.path_decode = function(data) {
+        const str = atob(data);
+        const bytes = new Uint8Array(str.length);
+        for (let i = 0; i < str.length; ++i) {
+          bytes[i] = str.charCodeAt(i);
+        }
+        const view = new DataView(bytes.buffer);
+        const n = view.getUint32(0, true);
+        const types = 4 + 8 * n;
+        const path = new Array(n);
+        for (let i = 0; i < n; ++i) {
+          path[i] = [view.getFloat32(4 + 8 * i, true), view.getFloat32(8 + 8 * i, true), bytes[types + i]];
+        }
+        return path;
+      };
       this.transform_mult = function(t1, t2) {
         if (t2.length === 2) {
           // WPointF
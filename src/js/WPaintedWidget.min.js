@@ -1 +1 @@
-WT_DECLARE_WT_MEMBER(10,JavaScriptConstructor,"WPaintedWidget",(function(t,n){n.wtObj=this;const e=this;this.imagePreloaders=[];this.images=[];this.canvas=document.getElementById("c"+n.id);this.repaint=function(){};this.widget=n;this.cancelPreloaders=function(){for(const t of e.imagePreloaders)t.cancel();e.imagePreloaders=[]}}));WT_DECLARE_WT_MEMBER(11,JavaScriptObject,"gfxUtils",function(){const t=1024,n=4080;return new function(){const e=this;this.path_crisp=function(t){return t.map((function(t){return[Math.floor(t[0])+.5,Math.floor(t[1])+.5,t[2]]}))};this.transform_mult=function(t,n){if(2===n.length){const e=n[0],r=n[1];return[t[0]*e+t[2]*r+t[4],t[1]*e+t[3]*r+t[5]]}if(3===n.length){if(8===n[2]||9===n[2])return n.slice(0);const e=n[0],r=n[1];return[t[0]*e+t[2]*r+t[4],t[1]*e+t[3]*r+t[5],n[2]]}if(4===n.length){let r,i,o,s,a;const c=e.transform_mult(t,[n[0],n[1]]);r=c[0];o=c[0];i=c[1];s=c[1];for(let c=0;c<3;++c){a=e.transform_mult(t,0===c?[e.rect_left(n),e.rect_bottom(n)]:1===c?[e.rect_right(n),e.rect_top(n)]:[e.rect_right(n),e.rect_bottom(n)]);r=Math.min(r,a[0]);o=Math.max(o,a[0]);i=Math.min(i,a[1]);s=Math.max(s,a[1])}return[r,i,o-r,s-i]}return 6===n.length?[t[0]*n[0]+t[2]*n[1],t[1]*n[0]+t[3]*n[1],t[0]*n[2]+t[2]*n[3],t[1]*n[2]+t[3]*n[3],t[0]*n[4]+t[2]*n[5]+t[4],t[1]*n[4]+t[3]*n[5]+t[5]]:[]};this.transform_apply=function(t,n){const r=e.transform_mult;return n.map((function(n){return r(t,n)}))};this.transform_det=function(t){const n=t[0],e=t[2],r=t[1];return n*t[3]-r*e};this.transform_adjoint=function(t){const n=t[0],e=t[2],r=t[1],i=t[3],o=t[4],s=t[5];return[i,-e,-r,n,s*r-o*i,-(s*n-o*e)]};this.transform_inverted=function(t){const n=e.transform_det(t);if(0!==n){const r=e.transform_adjoint(t);return[r[0]/n,r[2]/n,r[1]/n,r[3]/n,r[4]/n,r[5]/n]}console.log("inverted(): oops, determinant == 0");return t};this.transform_assign=function(t,n){t[0]=n[0];t[1]=n[1];t[2]=n[2];t[3]=n[3];t[4]=n[4];t[5]=n[5]};this.transform_equal=function(t,n){return t[0]===n[0]&&t[1]===n[1]&&t[2]===n[2]&&t[3]===n[3]&&t[4]===n[4]&&t[5]===n[5]};this.css_text=function(t){return"rgba("+t[0]+","+t[1]+","+t[2]+","+t[3]+")"};this.arcPosition=function(t,n,e,r,i){const o=-i/180*Math.PI;return[t+e*Math.cos(o),n+r*Math.sin(o)]};this.pnpoly=function(t,n){let r=!1,i=0,o=0;const s=t[0],a=t[1];let c,l;for(let t=0;t<n.length;++t){c=i;l=o;if(7===n[t][2]){const r=e.arcPosition(n[t][0],n[t][1],n[t+1][0],n[t+1][1],n[t+2][0]);c=r[0];l=r[1]}else if(9===n[t][2]){const r=e.arcPosition(n[t-2][0],n[t-2][1],n[t-1][0],n[t-1][1],n[t][0]+n[t][1]);c=r[0];l=r[1]}else if(8!==n[t][2]){c=n[t][0];l=n[t][1]}0!==n[t][2]&&o>a!=l>a&&s<(c-i)*(a-o)/(l-o)+i&&(r=!r);i=c;o=l}return r};this.rect_intersection=function(t,n){t=e.rect_normalized(t);n=e.rect_normalized(n);const r=e.rect_top,i=e.rect_bottom,o=e.rect_left,s=e.rect_right,a=Math.max(o(t),o(n)),c=Math.min(s(t),s(n)),l=Math.max(r(t),r(n));return[a,l,c-a,Math.min(i(t),i(n))-l]};this.drawRect=function(t,n,r,i){n=e.rect_normalized(n);const o=e.rect_top(n),s=e.rect_bottom(n),a=e.rect_left(n),c=e.rect_right(n),l=[[a,o,0],[c,o,1],[c,s,1],[a,s,1],[a,o,1]];e.drawPath(t,l,r,i,!1)};this.drawPath=function(t,n,r,i,o){let s=0,a=[],c=[],l=[];const f=1048576;function u(t){return t[0]}function h(t){return t[1]}function m(t){return t[2]}t.beginPath();n.length>0&&0!==m(n[0])&&t.moveTo(0,0);for(s=0;s<n.length;s++){const _=n[s];switch(m(_)){case 0:Math.abs(u(_))<=f&&Math.abs(h(_))<=f&&t.moveTo(u(_),h(_));break;case 1:!function(){const a=0===s?[0,0]:n[s-1];if(!r&&!o&&i&&(Math.abs(u(a))>f||Math.abs(h(a))>f||Math.abs(u(_))>f||Math.abs(h(_))>f)){!function(){const n=t.wtTransform?t.wtTransform:[1,0,0,1,0,0],r=e.transform_inverted(n),i=e.transform_mult(n,a),o=e.transform_mult(n,_),s=u(o)-u(i),c=h(o)-h(i),l=-50,f=t.canvas.width+50,m=-50,p=t.canvas.height+50;function g(t,n,e){return(e-t)/n}function d(t,n,e){return t+e*n}let b,w,P,M=null,T=null,y=null,x=null;if(u(i)<l&&u(o)>l){b=g(u(i),s,l);M=[l,d(h(i),c,b),b]}else if(u(i)>f&&u(o)<f){b=g(u(i),s,f);M=[f,d(h(i),c,b),b]}else{if(!(u(i)>l&&u(i)<f))return;M=[u(i),h(i),0]}if(h(i)<m&&h(o)>m){b=g(h(i),c,m);T=[d(u(i),s,b),m,b]}else if(h(i)>p&&h(o)<p){b=g(h(i),c,p);T=[d(u(i),s,b),p,b]}else{if(!(h(i)>m&&h(i)<p))return;T=[u(i),h(i),0]}w=M[2]>T[2]?[M[0],M[1]]:[T[0],T[1]];if(!(u(w)<l||u(w)>f||h(w)<m||h(w)>p)){if(u(i)<f&&u(o)>f){b=g(u(i),s,f);y=[f,d(h(i),c,b),b]}else if(u(i)>l&&u(o)<l){b=g(u(i),s,l);y=[l,d(h(i),c,b),b]}else{if(!(u(o)>l&&u(o)<f))return;y=[u(o),h(o),1]}if(h(i)<p&&h(o)>p){b=g(h(i),c,p);x=[d(u(i),s,b),p,b]}else if(h(i)>m&&h(o)<m){b=g(h(i),c,m);x=[d(u(i),s,b),m,b]}else{if(!(u(o)>m&&h(o)<p))return;x=[u(o),h(o),1]}P=y[2]<x[2]?[y[0],y[1]]:[x[0],x[1]];if(!(u(P)<l||u(P)>f||h(P)<m||h(P)>p)){w=e.transform_mult(r,w);P=e.transform_mult(r,P);t.moveTo(w[0],w[1]);t.lineTo(P[0],P[1])}}}();Math.abs(u(_))<=f&&Math.abs(h(_))<=f&&t.moveTo(u(_),h(_))}else t.lineTo(u(_),h(_))}();break;case 2:case 3:a.push(u(_),h(_));break;case 4:a.push(u(_),h(_));t.bezierCurveTo.apply(t,a);a=[];break;case 7:c.push(u(_),h(_));break;case 8:c.push(u(_));break;case 9:!function(){function n(t){const n=t%360;return n<0?n+360:n}function e(t){return t*Math.PI/180}const r=u(_),i=h(_),o=e(n(-r));let s;s=i>=360||i<=-360?o-2*Math.PI*(i>0?1:-1):e(n(-r-((a=i)>360?360:a<-360?-360:a)));var a;const l=i>0;c.push(o,s,l);t.arc.apply(t,c);c=[]}();break;case 5:l.push(u(_),h(_));break;case 6:l.push(u(_),h(_));t.quadraticCurveTo.apply(t,l);l=[]}}r&&t.fill();i&&t.stroke();o&&t.clip()};this.drawStencilAlongPath=function(t,n,r,i,o,s){function a(t){return t[1]}function c(t){return t[2]}for(let f=0;f<r.length;f++){const u=r[f];if((!s||!t.wtClipPath||e.pnpoly(u,e.transform_apply(t.wtClipPathTransform,t.wtClipPath)))&&(0===c(u)||1===c(u)||6===c(u)||4===c(u))){const r=e.transform_apply([1,0,0,1,(l=u,l[0]),a(u)],n);e.drawPath(t,r,i,o,!1)}}var l};this.drawText=function(r,i,o,s,a){if(a&&r.wtClipPath&&!e.pnpoly(a,e.transform_apply(r.wtClipPathTransform,r.wtClipPath)))return;const c=o&n;let l=null,f=null;switch(15&o){case 1:r.textAlign="left";l=e.rect_left(i);break;case 2:r.textAlign="right";l=e.rect_right(i);break;case 4:r.textAlign="center";l=e.rect_center(i).x}switch(c){case 128:r.textBaseline="top";f=e.rect_top(i);break;case t:r.textBaseline="bottom";f=e.rect_bottom(i);break;case 512:r.textBaseline="middle";f=e.rect_center(i).y}if(null===l||null===f)return;const u=r.fillStyle;r.fillStyle=r.strokeStyle;r.fillText(s,l,f);r.fillStyle=u};this.calcYOffset=function(n,e,r,i){return 512===i?-(e-1)*r/2+n*r:128===i?n*r:i===t?-(e-1-n)*r:0};this.drawTextOnPath=function(t,r,i,o,s,a,c,l,f){function u(t){return t[0]}function h(t){return t[1]}function m(t){return t[2]}const _=e.transform_apply(o,s);for(let o=0;o<s.length&&!(o>=r.length);o++){const p=s[o],g=_[o],d=r[o].split("\n");if(0===m(p)||1===m(p)||6===m(p)||4===m(p))if(0===a)for(let r=0;r<d.length;r++){const o=e.calcYOffset(r,d.length,c,l&n);e.drawText(t,[i[0]+u(g),i[1]+h(g)+o,i[2],i[3]],l,d[r],f?[u(g),h(g)]:null)}else{const r=a*Math.PI/180,o=Math.cos(-r),s=-Math.sin(-r),m=-s,_=o;t.save();t.transform(o,m,s,_,u(g),h(g));for(let r=0;r<d.length;r++){const o=e.calcYOffset(r,d.length,c,l&n);e.drawText(t,[i[0],i[1]+o,i[2],i[3]],l,d[r],f?[u(g),h(g)]:null)}t.restore()}}};this.setClipPath=function(t,n,r,i){if(i){t.setTransform.apply(t,r);e.drawPath(t,n,!1,!1,!0);t.setTransform(1,0,0,1,0,0)}t.wtClipPath=n;t.wtClipPathTransform=r};this.removeClipPath=function(t){delete t.wtClipPath;delete t.wtClipPathTransform};this.rect_top=function(t){return t[1]};this.rect_bottom=function(t){return t[1]+t[3]};this.rect_right=function(t){return t[0]+t[2]};this.rect_left=function(t){return t[0]};this.rect_topleft=function(t){return[t[0],t[1]]};this.rect_topright=function(t){return[t[0]+t[2],t[1]]};this.rect_bottomleft=function(t){return[t[0],t[1]+t[3]]};this.rect_bottomright=function(t){return[t[0]+t[2],t[1]+t[3]]};this.rect_center=function(t){return{x:(2*t[0]+t[2])/2,y:(2*t[1]+t[3])/2}};this.rect_normalized=function(t){let n,e,r,i;if(t[2]>0){n=t[0];r=t[2]}else{n=t[0]+t[2];r=-t[2]}if(t[3]>0){e=t[1];i=t[3]}else{e=t[1]+t[3];i=-t[3]}return[n,e,r,i]};this.drawImage=function(t,n,e,r,i){try{t.drawImage(n,r[0],r[1],r[2],r[3],i[0],i[1],i[2],i[3])}catch(t){let n="Error while drawing image: '"+e+"': "+t.name;t.message&&(n+=": "+t.message);console.error(n)}}}}());
\ No newline at end of file
+WT_DECLARE_WT_MEMBER(10,JavaScriptConstructor,"WPaintedWidget",(function(t,n){n.wtObj=this;const e=this;this.imagePreloaders=[];this.images=[];this.canvas=document.getElementById("c"+n.id);this.repaint=function(){};this.widget=n;this.cancelPreloaders=function(){for(const t of e.imagePreloaders)t.cancel();e.imagePreloaders=[]}}));WT_DECLARE_WT_MEMBER(11,JavaScriptObject,"gfxUtils",function(){const t=1024,n=4080;return new function(){const e=this;this.path_crisp=function(t){return t.map((function(t){return[Math.floor(t[0])+.5,Math.floor(t[1])+.5,t[2]]}))};this.path_decode=function(t){const n=atob(t),r=new Uint8Array(n.length);for(let t=0;t<n.length;++t)r[t]=n.charCodeAt(t);const o=new DataView(r.buffer),a=o.getUint32(0,!0),i=4+8*a,s=new Array(a);for(let t=0;t<a;++t)s[t]=[o.getFloat32(4+8*t,!0),o.getFloat32(8+8*t,!0),r[i+t]];return s};this.transform_mult=function(t,n){if(2===n.length){const e=n[0],r=n[1];return[t[0]*e+t[2]*r+t[4],t[1]*e+t[3]*r+t[5]]}if(3===n.length){if(8===n[2]||9===n[2])return n.slice(0);const e=n[0],r=n[1];return[t[0]*e+t[2]*r+t[4],t[1]*e+t[3]*r+t[5],n[2]]}if(4===n.length){let r,i,o,s,a;const c=e.transform_mult(t,[n[0],n[1]]);r=c[0];o=c[0];i=c[1];s=c[1];for(let c=0;c<3;++c){a=e.transform_mult(t,0===c?[e.rect_left(n),e.rect_bottom(n)]:1===c?[e.rect_right(n),e.rect_top(n)]:[e.rect_right(n),e.rect_bottom(n)]);r=Math.min(r,a[0]);o=Math.max(o,a[0]);i=Math.min(i,a[1]);s=Math.max(s,a[1])}return[r,i,o-r,s-i]}return 6===n.length?[t[0]*n[0]+t[2]*n[1],t[1]*n[0]+t[3]*n[1],t[0]*n[2]+t[2]*n[3],t[1]*n[2]+t[3]*n[3],t[0]*n[4]+t[2]*n[5]+t[4],t[1]*n[4]+t[3]*n[5]+t[5]]:[]};this.transform_apply=function(t,n){const r=e.transform_mult;return n.map((function(n){return r(t,n)}))};this.transform_det=function(t){const n=t[0],e=t[2],r=t[1];return n*t[3]-r*e};this.transform_adjoint=function(t){const n=t[0],e=t[2],r=t[1],i=t[3],o=t[4],s=t[5];return[i,-e,-r,n,s*r-o*i,-(s*n-o*e)]};this.transform_inverted=function(t){const n=e.transform_det(t);if(0!==n){const r=e.transform_adjoint(t);return[r[0]/n,r[2]/n,r[1]/n,r[3]/n,r[4]/n,r[5]/n]}console.log("inverted(): oops, determinant == 0");return t};this.transform_assign=function(t,n){t[0]=n[0];t[1]=n[1];t[2]=n[2];t[3]=n[3];t[4]=n[4];t[5]=n[5]};this.transform_equal=function(t,n){return t[0]===n[0]&&t[1]===n[1]&&t[2]===n[2]&&t[3]===n[3]&&t[4]===n[4]&&t[5]===n[5]};this.css_text=function(t){return"rgba("+t[0]+","+t[1]+","+t[2]+","+t[3]+")"};this.arcPosition=function(t,n,e,r,i){const o=-i/180*Math.PI;return[t+e*Math.cos(o),n+r*Math.sin(o)]};this.pnpoly=function(t,n){let r=!1,i=0,o=0;const s=t[0],a=t[1];let c,l;for(let t=0;t<n.length;++t){c=i;l=o;if(7===n[t][2]){const r=e.arcPosition(n[t][0],n[t][1],n[t+1][0],n[t+1][1],n[t+2][0]);c=r[0];l=r[1]}else if(9===n[t][2]){const r=e.arcPosition(n[t-2][0],n[t-2][1],n[t-1][0],n[t-1][1],n[t][0]+n[t][1]);c=r[0];l=r[1]}else if(8!==n[t][2]){c=n[t][0];l=n[t][1]}0!==n[t][2]&&o>a!=l>a&&s<(c-i)*(a-o)/(l-o)+i&&(r=!r);i=c;o=l}return r};this.rect_intersection=function(t,n){t=e.rect_normalized(t);n=e.rect_normalized(n);const r=e.rect_top,i=e.rect_bottom,o=e.rect_left,s=e.rect_right,a=Math.max(o(t),o(n)),c=Math.min(s(t),s(n)),l=Math.max(r(t),r(n));return[a,l,c-a,Math.min(i(t),i(n))-l]};this.drawRect=function(t,n,r,i){n=e.rect_normalized(n);const o=e.rect_top(n),s=e.rect_bottom(n),a=e.rect_left(n),c=e.rect_right(n),l=[[a,o,0],[c,o,1],[c,s,1],[a,s,1],[a,o,1]];e.drawPath(t,l,r,i,!1)};this.drawPath=function(t,n,r,i,o){let s=0,a=[],c=[],l=[];const f=1048576;function u(t){return t[0]}function h(t){return t[1]}function m(t){return t[2]}t.beginPath();n.length>0&&0!==m(n[0])&&t.moveTo(0,0);for(s=0;s<n.length;s++){const _=n[s];switch(m(_)){case 0:Math.abs(u(_))<=f&&Math.abs(h(_))<=f&&t.moveTo(u(_),h(_));break;case 1:!function(){const a=0===s?[0,0]:n[s-1];if(!r&&!o&&i&&(Math.abs(u(a))>f||Math.abs(h(a))>f||Math.abs(u(_))>f||Math.abs(h(_))>f)){!function(){const n=t.wtTransform?t.wtTransform:[1,0,0,1,0,0],r=e.transform_inverted(n),i=e.transform_mult(n,a),o=e.transform_mult(n,_),s=u(o)-u(i),c=h(o)-h(i),l=-50,f=t.canvas.width+50,m=-50,p=t.canvas.height+50;function g(t,n,e){return(e-t)/n}function d(t,n,e){return t+e*n}let b,w,P,M=null,T=null,y=null,x=null;if(u(i)<l&&u(o)>l){b=g(u(i),s,l);M=[l,d(h(i),c,b),b]}else if(u(i)>f&&u(o)<f){b=g(u(i),s,f);M=[f,d(h(i),c,b),b]}else{if(!(u(i)>l&&u(i)<f))return;M=[u(i),h(i),0]}if(h(i)<m&&h(o)>m){b=g(h(i),c,m);T=[d(u(i),s,b),m,b]}else if(h(i)>p&&h(o)<p){b=g(h(i),c,p);T=[d(u(i),s,b),p,b]}else{if(!(h(i)>m&&h(i)<p))return;T=[u(i),h(i),0]}w=M[2]>T[2]?[M[0],M[1]]:[T[0],T[1]];if(!(u(w)<l||u(w)>f||h(w)<m||h(w)>p)){if(u(i)<f&&u(o)>f){b=g(u(i),s,f);y=[f,d(h(i),c,b),b]}else if(u(i)>l&&u(o)<l){b=g(u(i),s,l);y=[l,d(h(i),c,b),b]}else{if(!(u(o)>l&&u(o)<f))return;y=[u(o),h(o),1]}if(h(i)<p&&h(o)>p){b=g(h(i),c,p);x=[d(u(i),s,b),p,b]}else if(h(i)>m&&h(o)<m){b=g(h(i),c,m);x=[d(u(i),s,b),m,b]}else{if(!(u(o)>m&&h(o)<p))return;x=[u(o),h(o),1]}P=y[2]<x[2]?[y[0],y[1]]:[x[0],x[1]];if(!(u(P)<l||u(P)>f||h(P)<m||h(P)>p)){w=e.transform_mult(r,w);P=e.transform_mult(r,P);t.moveTo(w[0],w[1]);t.lineTo(P[0],P[1])}}}();Math.abs(u(_))<=f&&Math.abs(h(_))<=f&&t.moveTo(u(_),h(_))}else t.lineTo(u(_),h(_))}();break;case 2:case 3:a.push(u(_),h(_));break;case 4:a.push(u(_),h(_));t.bezierCurveTo.apply(t,a);a=[];break;case 7:c.push(u(_),h(_));break;case 8:c.push(u(_));break;case 9:!function(){function n(t){const n=t%360;return n<0?n+360:n}function e(t){return t*Math.PI/180}const r=u(_),i=h(_),o=e(n(-r));let s;s=i>=360||i<=-360?o-2*Math.PI*(i>0?1:-1):e(n(-r-((a=i)>360?360:a<-360?-360:a)));var a;const l=i>0;c.push(o,s,l);t.arc.apply(t,c);c=[]}();break;case 5:l.push(u(_),h(_));break;case 6:l.push(u(_),h(_));t.quadraticCurveTo.apply(t,l);l=[]}}r&&t.fill();i&&t.stroke();o&&t.clip()};this.drawStencilAlongPath=function(t,n,r,i,o,s){function a(t){return t[1]}function c(t){return t[2]}for(let f=0;f<r.length;f++){const u=r[f];if((!s||!t.wtClipPath||e.pnpoly(u,e.transform_apply(t.wtClipPathTransform,t.wtClipPath)))&&(0===c(u)||1===c(u)||6===c(u)||4===c(u))){const r=e.transform_apply([1,0,0,1,(l=u,l[0]),a(u)],n);e.drawPath(t,r,i,o,!1)}}var l};this.drawText=function(r,i,o,s,a){if(a&&r.wtClipPath&&!e.pnpoly(a,e.transform_apply(r.wtClipPathTransform,r.wtClipPath)))return;const c=o&n;let l=null,f=null;switch(15&o){case 1:r.textAlign="left";l=e.rect_left(i);break;case 2:r.textAlign="right";l=e.rect_right(i);break;case 4:r.textAlign="center";l=e.rect_center(i).x}switch(c){case 128:r.textBaseline="top";f=e.rect_top(i);break;case t:r.textBaseline="bottom";f=e.rect_bottom(i);break;case 512:r.textBaseline="middle";f=e.rect_center(i).y}if(null===l||null===f)return;const u=r.fillStyle;r.fillStyle=r.strokeStyle;r.fillText(s,l,f);r.fillStyle=u};this.calcYOffset=function(n,e,r,i){return 512===i?-(e-1)*r/2+n*r:128===i?n*r:i===t?-(e-1-n)*r:0};this.drawTextOnPath=function(t,r,i,o,s,a,c,l,f){function u(t){return t[0]}function h(t){return t[1]}function m(t){return t[2]}const _=e.transform_apply(o,s);for(let o=0;o<s.length&&!(o>=r.length);o++){const p=s[o],g=_[o],d=r[o].split("\n");if(0===m(p)||1===m(p)||6===m(p)||4===m(p))if(0===a)for(let r=0;r<d.length;r++){const o=e.calcYOffset(r,d.length,c,l&n);e.drawText(t,[i[0]+u(g),i[1]+h(g)+o,i[2],i[3]],l,d[r],f?[u(g),h(g)]:null)}else{const r=a*Math.PI/180,o=Math.cos(-r),s=-Math.sin(-r),m=-s,_=o;t.save();t.transform(o,m,s,_,u(g),h(g));for(let r=0;r<d.length;r++){const o=e.calcYOffset(r,d.length,c,l&n);e.drawText(t,[i[0],i[1]+o,i[2],i[3]],l,d[r],f?[u(g),h(g)]:null)}t.restore()}}};this.setClipPath=function(t,n,r,i){if(i){t.setTransform.apply(t,r);e.drawPath(t,n,!1,!1,!0);t.setTransform(1,0,0,1,0,0)}t.wtClipPath=n;t.wtClipPathTransform=r};this.removeClipPath=function(t){delete t.wtClipPath;delete t.wtClipPathTransform};this.rect_top=function(t){return t[1]};this.rect_bottom=function(t){return t[1]+t[3]};this.rect_right=function(t){return t[0]+t[2]};this.rect_left=function(t){return t[0]};this.rect_topleft=function(t){return[t[0],t[1]]};this.rect_topright=function(t){return[t[0]+t[2],t[1]]};this.rect_bottomleft=function(t){return[t[0],t[1]+t[3]]};this.rect_bottomright=function(t){return[t[0]+t[2],t[1]+t[3]]};this.rect_center=function(t){return{x:(2*t[0]+t[2])/2,y:(2*t[1]+t[3])/2}};this.rect_normalized=function(t){let n,e,r,i;if(t[2]>0){n=t[0];r=t[2]}else{n=t[0]+t[2];r=-t[2]}if(t[3]>0){e=t[1];i=t[3]}else{e=t[1]+t[3];i=-t[3]}return[n,e,r,i]};this.drawImage=function(t,n,e,r,i){try{t.drawImage(n,r[0],r[1],r[2],r[3],i[0],i[1],i[2],i[3])}catch(t){let n="Error while drawing image: '"+e+"': "+t.name;t.message&&(n+=": "+t.message);console.error(n)}}}}());
\ No newline at end of file
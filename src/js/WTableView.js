@@ -793,3 +793,75 @@ WT_DECLARE_WT_MEMBER(
     };
   }
 );
+
+WT_DECLARE_WT_MEMBER(
+  2,
+  JavaScriptFunction,
+  "tableViewRows",
+  function(el, firstRow, lastRow, rowHeight, segments) {
+    /*
+     * A cell is either its text, or an array with its text and its
+     * style class.
+     */
+    function setCell(cell, data) {
+      if (Array.isArray(data)) {
+        cell.className = "Wt-tv-c " + data[1];
+        cell.textContent = data[0];
+      } else {
+        cell.className = "Wt-tv-c";
+        cell.textContent = data;
+      }
+    }
+
+    function createCell(data) {
+      const cell = document.createElement("div");
+      cell.style.height = rowHeight;
+      setCell(cell, data);
+      return cell;
+    }
+
+    let first = el.wtFirstRow;
+    const rows = el.children;
+
+    if (
+      first === undefined || lastRow < firstRow ||
+      first > lastRow || first + rows.length - 1 < firstRow
+    ) {
+      el.replaceChildren();
+    } else {
+      for (; first < firstRow; ++first) {
+        el.removeChild(el.firstElementChild);
+      }
+      while (first + rows.length - 1 > lastRow) {
+        el.removeChild(el.lastElementChild);
+      }
+    }
+
+    if (rows.length === 0) {
+      first = firstRow;
+    }
+
+    for (const segment of segments) {
+      const start = segment[0], cells = segment[1];
+      const last = first + rows.length - 1;
+
+      // rows that precede the rendered rows
+      const before = Math.max(0, Math.min(cells.length, first - start));
+      for (let i = before - 1; i >= 0; --i) {
+        el.insertBefore(createCell(cells[i]), el.firstElementChild);
+      }
+      first -= before;
+
+      for (let i = before; i < cells.length; ++i) {
+        const row = start + i;
+        if (row <= last) {
+          setCell(rows[row - first], cells[i]);
+        } else {
+          el.appendChild(createCell(cells[i]));
+        }
+      }
+    }
+
+    el.wtFirstRow = first;
+  }
+);
@@ -1 +1 @@
-WT_DECLARE_WT_MEMBER(1,JavaScriptConstructor,"WTableView",(function(t,e,l,o,n,i,s,c){e.wtObj=this;const r=this,d=t.WT,a=document.body.classList.contains("Wt-rtl"),f=s.id;function h(t){return a?-t.scrollLeft:t.scrollLeft}let u=0,p=0,g=0,m=0,b=0,y=0===o,T=0===n,w=!1,N=!1,E=!0,x=0,S=0,v=0,W=0;function L(){if(l.clientWidth&&l.clientHeight&&0===b&&(l.scrollTop<g||l.scrollTop>m||l.scrollLeft<u||l.scrollLeft>p||E)){t.emit(e,"scrolled",Math.round(h(l)),Math.round(l.scrollTop),Math.round(l.clientWidth),Math.round(l.clientHeight));E=!0}else t.emitOnUpdate(e,"scrolled",Math.round(h(l)),Math.round(l.scrollTop),Math.round(l.clientWidth),Math.round(l.clientHeight))}this.onContentsContainerScroll=function(){const t=d.getElement(f);S=i.scrollLeft=l.scrollLeft;x=t.scrollTop=l.scrollTop;L()};this.onHeaderContainerScroll=function(){S=l.scrollLeft=i.scrollLeft;L()};this.onHeaderColumnsContainerScroll=function(){const t=d.getElement(f);x=l.scrollTop=t.scrollTop;L()};l.wtResize=function(s,c,r,a){let b=!1;if(!y){s.scrollTop=o;b=!0;y=!0}if(!T){s.scrollLeft=n;b=!0;T=!0}b&&s.onscroll();const w=d.getElement(f),N=i.offsetHeight,E=i.closest(".Wt-tableview"),x=d.pxComputedStyle(E,"borderTopWidth")+d.pxComputedStyle(E,"borderBottomWidth"),S=E.offsetHeight-x-N;l.style.height=S+"px";const L=w.offsetWidth,C=d.pxComputedStyle(E,"borderLeftWidth")+d.pxComputedStyle(E,"borderRightWidth"),H=E.offsetWidth-C-L;l.style.width=H+"px";const I=l.offsetHeight-l.clientHeight;w.style.height=S-I+"px";if(H-v>(p-u)/2||S-W>(m-g)/2){v=H;W=S;const l=s.clientHeight===s.firstChild.offsetHeight?-1:s.clientHeight;t.emit(e,"scrolled",Math.round(h(s)),Math.round(s.scrollTop),Math.round(s.clientWidth),Math.round(l))}};function C(t){let e=0;for(const l of t.parentNode.childNodes){if(l.isEqualNode(t))return e;e++}return-1}function H(t){let e=-1,l=-1,o=!1,n=!1,i=null,s=d.target(t);for(;s&&void 0!==s.classList&&!s.classList.contains("Wt-tv-contents");){if(s.classList.contains("Wt-tv-c")){"true"===s.getAttribute("drop")&&(n=!0);s.classList.contains(c)&&(o=!0);i=s;s=s.parentNode;e=1*s.className.split(" ")[0].substring(7);l=C(i);break}s=s.parentNode}return{columnId:e,rowIdx:l,selected:o,drop:n,el:i}}function I(){return d.pxself(l.firstChild,"lineHeight")}let k,M=null;this.mouseDown=function(l,o){d.capture(null);const n=H(o);if(!o.ctrlKey&&!o.shiftKey){const l={ctrlKey:o.ctrlKey,shiftKey:o.shiftKey,target:o.target,srcElement:o.srcElement,type:o.type,which:o.which,touches:o.touches,changedTouches:o.changedTouches,pageX:o.pageX,pageY:o.pageY,clientX:o.clientX,clientY:o.clientY};M=setTimeout((function(){"true"===e.getAttribute("drag")&&function(t){return t.el.classList.contains(c)}(n)&&t._p_.dragStart(e,l)}),400)}};this.mouseUp=function(){clearTimeout(M)};this.resizeHandleMDown=function(o,n){const s=o.parentNode;let c=-(d.pxself(s,"width")-1),a=1e4;document.body.classList.contains("Wt-rtl")&&([c,a]=[-a,-c]);new d.SizeHandle(d,"h",o.offsetWidth,e.offsetHeight,c,a,"Wt-hsh2",(function(o){!function(o,n){document.body.classList.contains("Wt-rtl")&&(n=-n);const s=d.getElement(f),c=o.className.split(" ")[0],a=1*c.substring(7),h=o.parentNode,u=h.parentNode!==i,p=u?s.firstChild:l.firstChild,g=p.firstChild,m=p.querySelector("."+c),b=d.pxself(o,"width")-1+n;let y=o.nextSibling,T=m.nextSibling;const w=d.pxself(h,"width")+n+"px";h.style.width=p.style.width=g.style.width=w;if(u){s.style.width=w;s.firstChild.style.width=w;l.style.insetInlineStart=w;i.style.insetInlineStart=w}o.style.width=b+1+"px";m.style.width=b+1+"px";t.layouts2.adjust(e.childNodes[0].id,[[1,1]]);for(;y;y=y.nextSibling)if(T){T.style.insetInlineStart=d.pxself(T,"insetInlineStart")+n+"px";T=T.nextSibling}t.emit(e,"columnResized",a,parseInt(b));r.autoJavaScript()}(s,o)}),o,e,n,-2,-1)};let R,D,A=!1,K=!1,O=0;this.touchStart=function(t,e){R=t;D=e;K=!0;if(e.touches.length>1){clearTimeout(k);k=setTimeout((function(){j(t,e)}),1e3);O=e.touches.length}else{clearTimeout(k);O=1}};function j(l,o){t.emit(e,{name:"itemTouchSelectEvent",eventObject:l,event:o})}this.touchMove=function(){k&&clearTimeout(k);A=!0};this.touchEnd=function(t,e){k&&1!==O?clearTimeout(k):K&&!A&&0===e.touches.length&&1===O&&j(R,D);A=!1;K=!1};this.scrolled=function(t,e,l,o){u=t;p=e;g=l;m=o;E=!1};this.resetScroll=function(){const t=d.getElement(f);i.scrollLeft=S;l.scrollLeft=S;l.scrollTop=x;t.scrollTop=x};this.setScrollToPending=function(){b+=1};this.scrollToPx=function(t,e){x=e;S=t;this.resetScroll()};this.scrollTo=function(t,e,o,n,i){b>0&&(b-=1);if(-1!==e){const s=l.scrollTop,c=l.clientHeight,r=l.scrollLeft,d=l.clientWidth;0!==n&&4!==n&&5!==n||(s+c<e+I()?n=2:e<s&&(n=1));0!==o&&1!==o&&2!==o||(r+d<t+i?o=5:t<r&&(o=4));switch(n){case 1:l.scrollTop=e;break;case 2:l.scrollTop=e-(c-I());break;case 3:l.scrollTop=e-(c-I())/2}switch(o){case 4:l.scrollLeft=t;break;case 5:l.scrollLeft=t-(d-i);break;case 3:l.scrollLeft=t-(d-i)/2}l.onscroll()}};this.setItemDropsEnabled=function(t){w=t};this.setRowDropsEnabled=function(t){N=t};function X(t,e,l){if(l){const l=document.createElement("div");l.className="Wt-drop-site-"+e;t.style.position="relative";t.appendChild(l);t.dropVisual=l}else{t.style.position="";t.dropVisual.remove();delete t.dropVisual}}function _(t,e,o){if(-1===t){X(i,"bottom",o);return}if("top"===e&&t>0){t-=1;e="bottom"}const n=l.firstChild.firstChild;for(const l of n.childNodes){X(l.childNodes[t],e,o)}}function q(){const t=l.firstChild.firstChild.firstChild;return t?t.childNodes.length:0}let z=null,B=null;e.handleDragDrop=function(l,o,n,i,s){if(z){z.className=z.classNameOrig;z=null}if(B){_(B.row,B.side,!1);B=null}if("end"===l)return;const c=H(n);if(null!==c.ele)if(!c.selected&&c.drop&&w)if("drop"===l)t.emit(e,{name:"dropEvent",eventObject:o,event:n},c.rowIdx,c.columnId,i,s);else{o.className="Wt-valid-drop";z=c.el;z.classNameOrig=z.className;z.className=z.className+" Wt-drop-site"}else if(!c.selected&&N){if(!c.columnId){c.el=null;c.rowIdx=-1}const r=c.rowIdx,d=c.columnId,a="bottom";if("drop"===l)t.emit(e,{name:"rowDropEvent",eventObject:o,event:n},r,d,i,s,a);else{o.className="Wt-valid-drop";B={row:c.el?r:q()-1,side:a};_(B.row,B.side,!0)}}else o.className=""};this.onkeydown=function(t){const e=t||window.event;if(9===e.keyCode){d.cancelEvent(e);const o=H(e);if(!o.el)return;let n=o.el.parentNode;const i=C(o.el),s=C(n),c=n.parentNode.childNodes.length,r=n.childNodes.length,a=e.shiftKey;let f,h=!1,u=i;for(;;){for(;a?u>=0:u<r;u=a?u-1:u+1){f=u!==i||h?a?c-1:0:a?s-1:s+1;for(;a?f>=0:f<c;f=a?f-1:f+1){if(u===i&&f===s)return;n=n.parentNode.childNodes[f];const p=n.childNodes[u].querySelectorAll("input, select, textarea, button");if(p.length>0){setTimeout((function(){p.forEach((t=>t.dispatchEvent(new Event("focus",{bubbles:!0}))));p.forEach((t=>t.dispatchEvent(new Event("select",{bubbles:!0}))))}),0);return}}}u=a?r-1:0;h=!0}}else if(e.keyCode>=37&&e.keyCode<=40){const g=d.target(e);function l(t){return d.hasTag(t,"INPUT")&&"text"===t.type||d.hasTag(t,"TEXTAREA")}if(d.hasTag(g,"SELECT"))return;const m=H(e);if(!m.el)return;let b=m.el.parentNode,y=C(m.el),T=C(b);const w=b.parentNode.childNodes.length,N=b.childNodes.length;switch(e.keyCode){case 39:if(l(g)){if(d.getSelectionRange(g).start!==g.value.length)return}T++;break;case 38:y--;break;case 37:if(l(g)){if(0!==d.getSelectionRange(g).start)return}T--;break;case 40:y++;break;default:return}d.cancelEvent(e);if(y>-1&&y<N&&T>-1&&T<w){b=b.parentNode.childNodes[T];const E=b.childNodes[y].querySelectorAll("input, select, textarea, button");if(E.length>0){setTimeout((function(){E.forEach((t=>t.dispatchEvent(new Event("focus",{bubbles:!0}))))}),0);return}}}};this.autoJavaScript=function(){if(null===e.parentNode){e=l=i=null;this.autoJavaScript=function(){};return}if(d.isHidden(e))return;const o=d.getElement(f);if(!(d.isIE||K||x===l.scrollTop&&S===l.scrollLeft)){void 0===S?a&&d.isGecko?i.scrollLeft=l.scrollLeft=S=0:S=l.scrollLeft:i.scrollLeft=l.scrollLeft=S;o.scrollTop=l.scrollTop=x}let n=e.offsetWidth-d.pxComputedStyle(e,"borderInlineStartWidth")-d.pxComputedStyle(e,"borderInlineEndWidth");const s=l.offsetWidth-l.clientWidth;n-=o.clientWidth;if(n>200&&n!==l.tw){l.tw=n;l.style.width=n+"px";i.style.width=n-s+"px"}i.style.marginInlineEnd=s+"px";const c=l.offsetHeight-l.clientHeight,r=o.style;if(r&&r.marginBlockEnd!==c+"px"){r.marginBlockEnd=c+"px";t.layouts2.adjust(e.childNodes[0].id,[[1,0]])}}}));
\ No newline at end of file
+WT_DECLARE_WT_MEMBER(1,JavaScriptConstructor,"WTableView",(function(t,e,l,o,n,i,s,c){e.wtObj=this;const r=this,d=t.WT,a=document.body.classList.contains("Wt-rtl"),f=s.id;function h(t){return a?-t.scrollLeft:t.scrollLeft}let u=0,p=0,g=0,m=0,b=0,y=0===o,T=0===n,w=!1,N=!1,E=!0,x=0,S=0,v=0,W=0;function L(){if(l.clientWidth&&l.clientHeight&&0===b&&(l.scrollTop<g||l.scrollTop>m||l.scrollLeft<u||l.scrollLeft>p||E)){t.emit(e,"scrolled",Math.round(h(l)),Math.round(l.scrollTop),Math.round(l.clientWidth),Math.round(l.clientHeight));E=!0}else t.emitOnUpdate(e,"scrolled",Math.round(h(l)),Math.round(l.scrollTop),Math.round(l.clientWidth),Math.round(l.clientHeight))}this.onContentsContainerScroll=function(){const t=d.getElement(f);S=i.scrollLeft=l.scrollLeft;x=t.scrollTop=l.scrollTop;L()};this.onHeaderContainerScroll=function(){S=l.scrollLeft=i.scrollLeft;L()};this.onHeaderColumnsContainerScroll=function(){const t=d.getElement(f);x=l.scrollTop=t.scrollTop;L()};l.wtResize=function(s,c,r,a){let b=!1;if(!y){s.scrollTop=o;b=!0;y=!0}if(!T){s.scrollLeft=n;b=!0;T=!0}b&&s.onscroll();const w=d.getElement(f),N=i.offsetHeight,E=i.closest(".Wt-tableview"),x=d.pxComputedStyle(E,"borderTopWidth")+d.pxComputedStyle(E,"borderBottomWidth"),S=E.offsetHeight-x-N;l.style.height=S+"px";const L=w.offsetWidth,C=d.pxComputedStyle(E,"borderLeftWidth")+d.pxComputedStyle(E,"borderRightWidth"),H=E.offsetWidth-C-L;l.style.width=H+"px";const I=l.offsetHeight-l.clientHeight;w.style.height=S-I+"px";if(H-v>(p-u)/2||S-W>(m-g)/2){v=H;W=S;const l=s.clientHeight===s.firstChild.offsetHeight?-1:s.clientHeight;t.emit(e,"scrolled",Math.round(h(s)),Math.round(s.scrollTop),Math.round(s.clientWidth),Math.round(l))}};function C(t){let e=0;for(const l of t.parentNode.childNodes){if(l.isEqualNode(t))return e;e++}return-1}function H(t){let e=-1,l=-1,o=!1,n=!1,i=null,s=d.target(t);for(;s&&void 0!==s.classList&&!s.classList.contains("Wt-tv-contents");){if(s.classList.contains("Wt-tv-c")){"true"===s.getAttribute("drop")&&(n=!0);s.classList.contains(c)&&(o=!0);i=s;s=s.parentNode;e=1*s.className.split(" ")[0].substring(7);l=C(i);break}s=s.parentNode}return{columnId:e,rowIdx:l,selected:o,drop:n,el:i}}function I(){return d.pxself(l.firstChild,"lineHeight")}let k,M=null;this.mouseDown=function(l,o){d.capture(null);const n=H(o);if(!o.ctrlKey&&!o.shiftKey){const l={ctrlKey:o.ctrlKey,shiftKey:o.shiftKey,target:o.target,srcElement:o.srcElement,type:o.type,which:o.which,touches:o.touches,changedTouches:o.changedTouches,pageX:o.pageX,pageY:o.pageY,clientX:o.clientX,clientY:o.clientY};M=setTimeout((function(){"true"===e.getAttribute("drag")&&function(t){return t.el.classList.contains(c)}(n)&&t._p_.dragStart(e,l)}),400)}};this.mouseUp=function(){clearTimeout(M)};this.resizeHandleMDown=function(o,n){const s=o.parentNode;let c=-(d.pxself(s,"width")-1),a=1e4;document.body.classList.contains("Wt-rtl")&&([c,a]=[-a,-c]);new d.SizeHandle(d,"h",o.offsetWidth,e.offsetHeight,c,a,"Wt-hsh2",(function(o){!function(o,n){document.body.classList.contains("Wt-rtl")&&(n=-n);const s=d.getElement(f),c=o.className.split(" ")[0],a=1*c.substring(7),h=o.parentNode,u=h.parentNode!==i,p=u?s.firstChild:l.firstChild,g=p.firstChild,m=p.querySelector("."+c),b=d.pxself(o,"width")-1+n;let y=o.nextSibling,T=m.nextSibling;const w=d.pxself(h,"width")+n+"px";h.style.width=p.style.width=g.style.width=w;if(u){s.style.width=w;s.firstChild.style.width=w;l.style.insetInlineStart=w;i.style.insetInlineStart=w}o.style.width=b+1+"px";m.style.width=b+1+"px";t.layouts2.adjust(e.childNodes[0].id,[[1,1]]);for(;y;y=y.nextSibling)if(T){T.style.insetInlineStart=d.pxself(T,"insetInlineStart")+n+"px";T=T.nextSibling}t.emit(e,"columnResized",a,parseInt(b));r.autoJavaScript()}(s,o)}),o,e,n,-2,-1)};let R,D,A=!1,K=!1,O=0;this.touchStart=function(t,e){R=t;D=e;K=!0;if(e.touches.length>1){clearTimeout(k);k=setTimeout((function(){j(t,e)}),1e3);O=e.touches.length}else{clearTimeout(k);O=1}};function j(l,o){t.emit(e,{name:"itemTouchSelectEvent",eventObject:l,event:o})}this.touchMove=function(){k&&clearTimeout(k);A=!0};this.touchEnd=function(t,e){k&&1!==O?clearTimeout(k):K&&!A&&0===e.touches.length&&1===O&&j(R,D);A=!1;K=!1};this.scrolled=function(t,e,l,o){u=t;p=e;g=l;m=o;E=!1};this.resetScroll=function(){const t=d.getElement(f);i.scrollLeft=S;l.scrollLeft=S;l.scrollTop=x;t.scrollTop=x};this.setScrollToPending=function(){b+=1};this.scrollToPx=function(t,e){x=e;S=t;this.resetScroll()};this.scrollTo=function(t,e,o,n,i){b>0&&(b-=1);if(-1!==e){const s=l.scrollTop,c=l.clientHeight,r=l.scrollLeft,d=l.clientWidth;0!==n&&4!==n&&5!==n||(s+c<e+I()?n=2:e<s&&(n=1));0!==o&&1!==o&&2!==o||(r+d<t+i?o=5:t<r&&(o=4));switch(n){case 1:l.scrollTop=e;break;case 2:l.scrollTop=e-(c-I());break;case 3:l.scrollTop=e-(c-I())/2}switch(o){case 4:l.scrollLeft=t;break;case 5:l.scrollLeft=t-(d-i);break;case 3:l.scrollLeft=t-(d-i)/2}l.onscroll()}};this.setItemDropsEnabled=function(t){w=t};this.setRowDropsEnabled=function(t){N=t};function X(t,e,l){if(l){const l=document.createElement("div");l.className="Wt-drop-site-"+e;t.style.position="relative";t.appendChild(l);t.dropVisual=l}else{t.style.position="";t.dropVisual.remove();delete t.dropVisual}}function _(t,e,o){if(-1===t){X(i,"bottom",o);return}if("top"===e&&t>0){t-=1;e="bottom"}const n=l.firstChild.firstChild;for(const l of n.childNodes){X(l.childNodes[t],e,o)}}function q(){const t=l.firstChild.firstChild.firstChild;return t?t.childNodes.length:0}let z=null,B=null;e.handleDragDrop=function(l,o,n,i,s){if(z){z.className=z.classNameOrig;z=null}if(B){_(B.row,B.side,!1);B=null}if("end"===l)return;const c=H(n);if(null!==c.ele)if(!c.selected&&c.drop&&w)if("drop"===l)t.emit(e,{name:"dropEvent",eventObject:o,event:n},c.rowIdx,c.columnId,i,s);else{o.className="Wt-valid-drop";z=c.el;z.classNameOrig=z.className;z.className=z.className+" Wt-drop-site"}else if(!c.selected&&N){if(!c.columnId){c.el=null;c.rowIdx=-1}const r=c.rowIdx,d=c.columnId,a="bottom";if("drop"===l)t.emit(e,{name:"rowDropEvent",eventObject:o,event:n},r,d,i,s,a);else{o.className="Wt-valid-drop";B={row:c.el?r:q()-1,side:a};_(B.row,B.side,!0)}}else o.className=""};this.onkeydown=function(t){const e=t||window.event;if(9===e.keyCode){d.cancelEvent(e);const o=H(e);if(!o.el)return;let n=o.el.parentNode;const i=C(o.el),s=C(n),c=n.parentNode.childNodes.length,r=n.childNodes.length,a=e.shiftKey;let f,h=!1,u=i;for(;;){for(;a?u>=0:u<r;u=a?u-1:u+1){f=u!==i||h?a?c-1:0:a?s-1:s+1;for(;a?f>=0:f<c;f=a?f-1:f+1){if(u===i&&f===s)return;n=n.parentNode.childNodes[f];const p=n.childNodes[u].querySelectorAll("input, select, textarea, button");if(p.length>0){setTimeout((function(){p.forEach((t=>t.dispatchEvent(new Event("focus",{bubbles:!0}))));p.forEach((t=>t.dispatchEvent(new Event("select",{bubbles:!0}))))}),0);return}}}u=a?r-1:0;h=!0}}else if(e.keyCode>=37&&e.keyCode<=40){const g=d.target(e);function l(t){return d.hasTag(t,"INPUT")&&"text"===t.type||d.hasTag(t,"TEXTAREA")}if(d.hasTag(g,"SELECT"))return;const m=H(e);if(!m.el)return;let b=m.el.parentNode,y=C(m.el),T=C(b);const w=b.parentNode.childNodes.length,N=b.childNodes.length;switch(e.keyCode){case 39:if(l(g)){if(d.getSelectionRange(g).start!==g.value.length)return}T++;break;case 38:y--;break;case 37:if(l(g)){if(0!==d.getSelectionRange(g).start)return}T--;break;case 40:y++;break;default:return}d.cancelEvent(e);if(y>-1&&y<N&&T>-1&&T<w){b=b.parentNode.childNodes[T];const E=b.childNodes[y].querySelectorAll("input, select, textarea, button");if(E.length>0){setTimeout((function(){E.forEach((t=>t.dispatchEvent(new Event("focus",{bubbles:!0}))))}),0);return}}}};this.autoJavaScript=function(){if(null===e.parentNode){e=l=i=null;this.autoJavaScript=function(){};return}if(d.isHidden(e))return;const o=d.getElement(f);if(!(d.isIE||K||x===l.scrollTop&&S===l.scrollLeft)){void 0===S?a&&d.isGecko?i.scrollLeft=l.scrollLeft=S=0:S=l.scrollLeft:i.scrollLeft=l.scrollLeft=S;o.scrollTop=l.scrollTop=x}let n=e.offsetWidth-d.pxComputedStyle(e,"borderInlineStartWidth")-d.pxComputedStyle(e,"borderInlineEndWidth");const s=l.offsetWidth-l.clientWidth;n-=o.clientWidth;if(n>200&&n!==l.tw){l.tw=n;l.style.width=n+"px";i.style.width=n-s+"px"}i.style.marginInlineEnd=s+"px";const c=l.offsetHeight-l.clientHeight,r=o.style;if(r&&r.marginBlockEnd!==c+"px"){r.marginBlockEnd=c+"px";t.layouts2.adjust(e.childNodes[0].id,[[1,0]])}}}));WT_DECLARE_WT_MEMBER(2,JavaScriptFunction,"tableViewRows",(function(e,t,l,n,o){function i(e,t){if(Array.isArray(t)){e.className="Wt-tv-c "+t[1];e.textContent=t[0]}else{e.className="Wt-tv-c";e.textContent=t}}function r(e){const t=document.createElement("div");t.style.height=n;i(t,e);return t}let c=e.wtFirstRow;const s=e.children;if(void 0===c||l<t||c>l||c+s.length-1<t)e.replaceChildren();else{for(;c<t;++c)e.removeChild(e.firstElementChild);for(;c+s.length-1>l;)e.removeChild(e.lastElementChild)}0===s.length&&(c=t);for(const t of o){const l=t[0],n=t[1],o=c+s.length-1,h=Math.max(0,Math.min(n.length,c-l));for(let t=h-1;t>=0;--t)e.insertBefore(r(n[t]),e.firstElementChild);c-=h;for(let t=h;t<n.length;++t){const h=l+t;h<=o?i(s[h-c],n[t]):e.appendChild(r(n[t]))}}e.wtFirstRow=c}));
\ No newline at end of file
@@ -190,6 +190,8 @@ public:
   ::int64_t maxFormDataSize() const;
   int maxPendingEvents() const;
   ::int64_t isapiMaxMemoryRequestSize() const;
+  ::int64_t maxSessionMemory() const;
+  ::int64_t maxTotalSessionMemory() const;
   SessionTracking sessionTracking() const;
   bool reloadIsNewSession() const;
   int sessionTimeout() const;
@@ -293,6 +295,7 @@ public:
   void setTrustedProxies(const std::vector<Network> &trustedProxies);
 
   void setBootstrapMethod(BootstrapMethod method);
+  void setMaxSessionMemory(::int64_t bytes);
 
   std::string generateSessionId();
   bool registerSessionId(const std::string& oldId, const std::string& newId);
@@ -331,6 +334,8 @@ private:
   ::int64_t       maxFormDataSize_;
   int             maxPendingEvents_;
   ::int64_t       isapiMaxMemoryRequestSize_;
+  ::int64_t       maxSessionMemory_;
+  ::int64_t       maxTotalSessionMemory_;
   SessionTracking sessionTracking_;
   bool            reloadIsNewSession_;
   int             sessionTimeout_;
@@ -0,0 +1,81 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_MEMORY_ACCOUNTING_H_
+#define WT_MEMORY_ACCOUNTING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <Wt/WDllDefs.h>
+
+namespace Wt {
+
+/*
+ * Heap usage attributed to a session.
+ *
+ * When Wt is built with ENABLE_SESSION_MEMORY_ACCOUNTING, the global
+ * operator new and delete are replaced, and every allocation made
+ * while a thread is attached to an account (see
+ * MemoryAccounting::attach()) is charged to that account, until it
+ * is freed again, possibly from another thread.
+ *
+ * An account is reference counted: it stays alive as long as its
+ * owner, a thread that is attached to it, or an allocation that was
+ * charged to it still refers to it.
+ *
+ * A running total of all accounts is kept as well (see
+ * totalBytes()). To avoid contention on a single counter for every
+ * allocation, an account only adds its changes to the total once they
+ * add up to at least ReportGranularity bytes.
+ */
+class WT_API MemoryAccount
+{
+public:
+  // Returns nullptr when memory accounting is not compiled in
+  static MemoryAccount *create();
+
+  void addRef();
+  void release();
+
+  // Bytes currently allocated and charged to this account
+  ::int64_t bytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+  // Bytes charged to all accounts, accurate up to ReportGranularity
+  // for every account
+  static ::int64_t totalBytes();
+
+  static const ::int64_t ReportGranularity = 16 * 1024;
+
+  void allocated(std::size_t size);
+  void freed(std::size_t size);
+
+private:
+  MemoryAccount();
+
+  std::atomic< ::int64_t> bytes_;
+  std::atomic< ::int64_t> reported_;
+  std::atomic<long> refCount_;
+
+  void report(::int64_t bytes);
+};
+
+class WT_API MemoryAccounting
+{
+public:
+  // Whether memory accounting was compiled in
+  static bool enabled();
+
+  // Charges allocations of the current thread to the given account,
+  // which may be nullptr.
+  static void attach(MemoryAccount *account);
+  static MemoryAccount *current();
+};
+
+}
+
+#endif // WT_MEMORY_ACCOUNTING_H_
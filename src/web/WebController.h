@@ -130,9 +130,19 @@ public:
 
 #ifndef WT_CNOR
   bool handleApplicationEvent(const std::shared_ptr<ApplicationEvent>& event);
+
+  void subscribe(const std::string& topic, const std::string& sessionId);
+  void unsubscribe(const std::string& topic, const std::string& sessionId);
+  void broadcast(const std::string& topic, const Function& function,
+                 bool coalesce);
+  std::size_t subscriberCount(const std::string& topic);
 #endif // WT_CNOR
 
   std::vector<std::string> sessions(bool onlyRendered = false);
+
+  // heap memory charged to a session or to all sessions, -1 if unknown
+  ::int64_t memoryUsage(const std::string& sessionId);
+  ::int64_t memoryUsage();
   bool expireSessions();
   void start();
   void shutdown();
@@ -175,6 +185,37 @@ private:
   typedef std::map<std::string, std::shared_ptr<WebSession> > SessionMap;
   SessionMap sessions_;
 
+  struct BroadcastTopic {
+    BroadcastTopic() : generation(0) { }
+
+    std::set<std::string> sessions;
+    // incremented for every broadcast, used to detect superseded ones
+    std::atomic<unsigned long> generation;
+  };
+
+  typedef std::map<std::string, std::shared_ptr<BroadcastTopic> > TopicMap;
+  TopicMap topics_;
+  // topics a session is subscribed to, to clean up when it is removed
+  std::map<std::string, std::set<std::string> > sessionTopics_;
+
+#ifdef WT_THREADED
+  // mutex to protect access to the topics. It may be taken while
+  // holding mutex_, but never the other way around.
+  std::mutex topicsMutex_;
+#endif // WT_THREADED
+
+  void unsubscribeAll(const std::string& sessionId);
+  void renameSubscriptions(const std::string& sessionId,
+                           const std::string& newSessionId);
+#ifndef WT_CNOR
+  void deliverBroadcast(const std::shared_ptr<BroadcastTopic>& topic,
+                        unsigned long generation,
+                        const std::shared_ptr<Function>& function,
+                        bool coalesce,
+                        const std::shared_ptr<std::vector<std::string> >& ids,
+                        std::size_t begin, std::size_t end);
+#endif // WT_CNOR
+
 #ifdef WT_THREADED
   // mutex to protect access to the sessions map and plain/ajax session
   // counts
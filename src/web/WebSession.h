@@ -25,6 +25,7 @@
 #include <boost/thread.hpp>
 #endif // WT_TARGET_JAVA
 
+#include "MemoryAccounting.h"
 #include "TimeUtil.h"
 #include "WebRenderer.h"
 #include "WebRequest.h"
@@ -140,6 +141,10 @@ public:
 
 #ifndef WT_TARGET_JAVA
   Time expireTime() const { return expire_; }
+
+  MemoryAccount *memoryAccount() const { return memoryAccount_; }
+  // heap memory charged to this session, or -1 if not accounted
+  ::int64_t memoryUsage() const;
 #endif // WT_TARGET_JAVA
 
   bool dead() { return state_ == State::Dead; }
@@ -345,6 +350,7 @@ private:
 #else
   Time             expire_;
 #endif
+  MemoryAccount   *memoryAccount_;
 #endif
 
 #ifdef WT_BOOST_THREADS